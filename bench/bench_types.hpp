@@ -0,0 +1,119 @@
+#pragma once
+#include <morfo/morfo.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace mrf::bench {
+
+/* 12 bytes, no annotations - every member gets its own bucket */
+struct Small {
+    int id{};
+    float x{};
+    float y{};
+
+    static Small make(std::size_t i) {
+        return Small{ int(i), float(i) * 0.5f, float(i) * 0.25f };
+    }
+
+    template <typename TItem>
+    static double checksum(const TItem& item) {
+        return item.id + item.x + item.y;
+    }
+};
+
+/* ~64 bytes, "hot" bucket with the frequently accessed members, the rest in separate buckets */
+struct Medium {
+    [[= mrf::hot]] int id{};
+    [[= mrf::hot]] float x{};
+    [[= mrf::hot]] float y{};
+    [[= mrf::hot]] float z{};
+    double mass{};
+    std::int64_t timestamp{};
+    std::array<char, 32> tag{};
+
+    static Medium make(std::size_t i) {
+        return Medium{ int(i), float(i), float(i) * 0.5f, float(i) * 0.25f, double(i) * 2.0, std::int64_t(i) * 1000, {} };
+    }
+
+    template <typename TItem>
+    static double checksum(const TItem& item) {
+        return item.id + item.x + item.y + item.z + item.mass + double(item.timestamp);
+    }
+};
+
+/* ~300 bytes, mostly cold payload in the default "cold" bucket */
+struct[[= mrf::cold]] Wide {
+    [[= mrf::hot]] int id{};
+    [[= mrf::hot]] float score{};
+    std::string name;
+    std::array<double, 16> history{};
+    std::array<char, 128> payload{};
+
+    static Wide make(std::size_t i) {
+        return Wide{ int(i), float(i) * 0.1f, "wide", {}, {} };
+    }
+
+    template <typename TItem>
+    static double checksum(const TItem& item) {
+        return item.id + item.score + item.history[0] + double(item.name.size());
+    }
+};
+
+/* AoSoA "hot" bucket (tiles of 8 rows) */
+struct Tiled {
+    [[= mrf::hot, = mrf::aosoa<8>]] float x{};
+    [[= mrf::hot]] float y{};
+    [[= mrf::hot]] float z{};
+    int id{};
+
+    static Tiled make(std::size_t i) {
+        return Tiled{ float(i), float(i) * 0.5f, float(i) * 0.25f, int(i) };
+    }
+
+    template <typename TItem>
+    static double checksum(const TItem& item) {
+        return item.id + item.x + item.y + item.z;
+    }
+};
+
+/* `T` of both `std::vector<T>` and `mrf::vector<T>` */
+template <typename TContainer>
+struct original {
+    using type = typename TContainer::value_type;
+};
+
+template <typename T, typename Alloc>
+struct original<mrf::vector<T, Alloc>> {
+    using type = T;
+};
+
+template <typename TContainer>
+using original_t = typename original<TContainer>::type;
+
+template <typename TContainer>
+inline constexpr bool is_mrf_vector_v = !std::is_same_v<TContainer, std::vector<original_t<TContainer>>>;
+
+/* `n` rows with the ids shuffled (the same sequence for the same `n`) */
+template <typename TContainer>
+TContainer make_shuffled(std::size_t n) {
+    using T = original_t<TContainer>;
+
+    std::vector<std::size_t> ids(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        ids[i] = i;
+    }
+    std::ranges::shuffle(ids, std::mt19937_64{ n });
+
+    TContainer container;
+    container.reserve(n);
+    for (const std::size_t id : ids) {
+        container.push_back(T::make(id));
+    }
+    return container;
+}
+} // namespace mrf::bench
\ No newline at end of file
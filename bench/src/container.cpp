@@ -0,0 +1,163 @@
+#include "bench_types.hpp"
+#include <benchmark/benchmark.h>
+#include <morfo/morfo.hpp>
+#include <random>
+
+namespace mrf::bench::container {
+
+template <typename TContainer>
+void push_back(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto n = std::size_t(state.range(0));
+
+    for (auto _ : state) {
+        TContainer container;
+        for (std::size_t i = 0; i < n; ++i) {
+            container.push_back(T::make(i));
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * n));
+}
+
+/* Bulk load from an AoS source */
+template <typename TContainer>
+void bulk_load(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto n = std::size_t(state.range(0));
+
+    std::vector<T> source;
+    for (std::size_t i = 0; i < n; ++i) {
+        source.push_back(T::make(i));
+    }
+
+    for (auto _ : state) {
+        TContainer container;
+        container.append_range(source);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * n));
+}
+
+/* Every member of every row */
+template <typename TContainer>
+void full_scan(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        double sum = 0;
+        for (const auto& item : container) {
+            sum += T::checksum(item);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * container.size()));
+}
+
+/* A single member of every row - where SoA shines */
+template <typename TContainer>
+void member_scan(benchmark::State& state) {
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const auto& item : container) {
+            sum += item.id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * container.size()));
+}
+
+/* Same as `member_scan` but through `mrf::vector::fast_view` */
+template <typename TContainer>
+void member_scan_fast_view(benchmark::State& state) {
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const auto& item : container.fast_view()) {
+            sum += item.id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * container.size()));
+}
+
+template <typename TContainer>
+void random_access(benchmark::State& state) {
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    std::vector<std::size_t> indices(container.size());
+    std::uniform_int_distribution<std::size_t> distribution(0, container.size() - 1);
+    std::ranges::generate(indices, [&, rng = std::mt19937_64{ 42 }] mutable { return distribution(rng); });
+
+    for (auto _ : state) {
+        std::int64_t sum = 0;
+        for (const std::size_t idx : indices) {
+            sum += container[idx].id;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * indices.size()));
+}
+
+/* Conversion into `std::vector<T>` (plain copy for the AoS baseline) */
+template <typename TContainer>
+void collect(benchmark::State& state) {
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        if constexpr (is_mrf_vector_v<TContainer>) {
+            auto collected = container.collect();
+            benchmark::DoNotOptimize(collected);
+        } else {
+            auto collected = container;
+            benchmark::DoNotOptimize(collected);
+        }
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * container.size()));
+}
+
+/* `mrf::parallel_collect` with the thread count (second argument) */
+template <typename TContainer>
+void parallel_collect(benchmark::State& state) {
+    const auto container = make_shuffled<TContainer>(std::size_t(state.range(0)));
+    mrf::thread_pool pool(std::size_t(state.range(1)));
+
+    for (auto _ : state) {
+        auto collected = mrf::parallel_collect(container, pool);
+        benchmark::DoNotOptimize(collected);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * container.size()));
+}
+
+// clang-format off
+#define MRF_BENCH_LAYOUTS(bench)                                                                      \
+    BENCHMARK_TEMPLATE(bench, std::vector<Small>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);      \
+    BENCHMARK_TEMPLATE(bench, mrf::vector<Small>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);      \
+    BENCHMARK_TEMPLATE(bench, std::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);     \
+    BENCHMARK_TEMPLATE(bench, mrf::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);     \
+    BENCHMARK_TEMPLATE(bench, std::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);       \
+    BENCHMARK_TEMPLATE(bench, mrf::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);       \
+    BENCHMARK_TEMPLATE(bench, std::vector<Tiled>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);      \
+    BENCHMARK_TEMPLATE(bench, mrf::vector<Tiled>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20)
+
+MRF_BENCH_LAYOUTS(push_back);
+MRF_BENCH_LAYOUTS(bulk_load);
+MRF_BENCH_LAYOUTS(full_scan);
+MRF_BENCH_LAYOUTS(member_scan);
+MRF_BENCH_LAYOUTS(random_access);
+MRF_BENCH_LAYOUTS(collect);
+
+BENCHMARK_TEMPLATE(member_scan_fast_view, mrf::vector<Small>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(member_scan_fast_view, mrf::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(member_scan_fast_view, mrf::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(member_scan_fast_view, mrf::vector<Tiled>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(parallel_collect, mrf::vector<Medium>)
+    ->ArgsProduct({ { 1 << 22 }, benchmark::CreateRange(1, 64, 2) })
+    ->UseRealTime();
+// clang-format on
+} // namespace mrf::bench::container
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "bench_types.hpp"
+#include <benchmark/benchmark.h>
+#include <morfo/morfo.hpp>
+#include <algorithm>
+
+namespace mrf::bench::sort {
+
+/* Plain AoS insertion sort - baseline of `mrf::insertsort` */
+template <typename T>
+void aos_insertsort(std::vector<T>& items) {
+    for (std::size_t i = 1; i < items.size(); ++i) {
+        T item = std::move(items[i]);
+        std::size_t j = i;
+        for (; j > 0 && item.id < items[j - 1].id; --j) {
+            items[j] = std::move(items[j - 1]);
+        }
+        items[j] = std::move(item);
+    }
+}
+
+template <typename TContainer>
+void introsort(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto source = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = source;
+        state.ResumeTiming();
+
+        if constexpr (is_mrf_vector_v<TContainer>) {
+            mrf::introsort(container, std::less{}, mrf::proj::member<^^T::id>);
+        } else {
+            std::ranges::sort(container, std::less{}, &T::id);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * source.size()));
+}
+
+template <typename TContainer>
+void insertsort(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto source = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = source;
+        state.ResumeTiming();
+
+        if constexpr (is_mrf_vector_v<TContainer>) {
+            mrf::insertsort(container, std::less{}, mrf::proj::member<^^T::id>);
+        } else {
+            aos_insertsort(container);
+        }
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * source.size()));
+}
+
+/* `mrf::vector` only: permutation based sorts */
+template <typename TContainer>
+void permutation_sort(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto source = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = source;
+        state.ResumeTiming();
+
+        mrf::permutation_sort(container, std::less{}, mrf::proj::member<^^T::id>);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * source.size()));
+}
+
+template <typename TContainer>
+void radix_sort(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto source = make_shuffled<TContainer>(std::size_t(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = source;
+        state.ResumeTiming();
+
+        mrf::radix_sort(container, mrf::proj::member<^^T::id>);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * source.size()));
+}
+
+/* Scaling of `mrf::parallel_sort` with the thread count (second argument) */
+template <typename TContainer>
+void parallel_sort(benchmark::State& state) {
+    using T = original_t<TContainer>;
+    const auto source = make_shuffled<TContainer>(std::size_t(state.range(0)));
+    mrf::thread_pool pool(std::size_t(state.range(1)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto container = source;
+        state.ResumeTiming();
+
+        mrf::parallel_sort(container, std::less{}, mrf::proj::member<^^T::id>, pool);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(std::int64_t(state.iterations() * source.size()));
+}
+
+// clang-format off
+BENCHMARK_TEMPLATE(introsort, std::vector<Small>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(introsort, mrf::vector<Small>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(introsort, std::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(introsort, mrf::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(introsort, std::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(introsort, mrf::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(insertsort, std::vector<Small>)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(insertsort, mrf::vector<Small>)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(insertsort, std::vector<Wide>)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+BENCHMARK_TEMPLATE(insertsort, mrf::vector<Wide>)->RangeMultiplier(4)->Range(1 << 6, 1 << 12);
+
+BENCHMARK_TEMPLATE(permutation_sort, mrf::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(permutation_sort, mrf::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(radix_sort, mrf::vector<Medium>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(radix_sort, mrf::vector<Wide>)->RangeMultiplier(16)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(parallel_sort, mrf::vector<Medium>)
+    ->ArgsProduct({ { 1 << 22 }, benchmark::CreateRange(1, 64, 2) })
+    ->UseRealTime();
+// clang-format on
+} // namespace mrf::bench::sort
\ No newline at end of file
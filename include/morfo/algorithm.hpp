@@ -1,11 +1,37 @@
 #pragma once
 #include "morfo/vector.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <vector>
 
 namespace mrf {
+namespace cpt {
+/**
+ * Keys which can be sorted by `mrf::radix_sort`: integral, enumeration and 32/64-bit floating point types.
+ */
+template <typename T>
+concept radix_key = std::is_integral_v<T> || std::is_enum_v<T> ||
+                    (std::is_floating_point_v<T> && (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)));
+} // namespace cpt
+
 namespace impl {
 /* Collections smaller than 32 are being sorted using insertion sort */
 static constexpr std::ptrdiff_t insertion_sort_threshold = 32;
 
+/* Partial insertion sort gives up once it moved more than 8 elements (the range ain't nearly sorted) */
+static constexpr std::ptrdiff_t partial_insertion_sort_limit = 8;
+
+/* Block size of the branchless partition (offsets of misplaced elements are collected per block) */
+static constexpr std::ptrdiff_t partition_block_size = 64;
+
+static constexpr ptrdiff_t lg(ptrdiff_t n) {
+    return std::bit_width(std::make_unsigned_t<ptrdiff_t>(n)) - 1;
+}
+
 template <typename Rng>
 static constexpr void swap_elements(Rng& rng, std::ptrdiff_t i, std::ptrdiff_t j) {
     std::tuple tmp = rng[i].steal_into_tuple();
@@ -71,40 +97,195 @@ dnf_partition_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, std
     return { lt, gt + 1 };
 }
 
+/**
+ * Branchless block partition (BlockQuicksort-like) for arithmetic keys: [first, mid) < pivot <= [mid, last).
+ * Misplaced elements are found block by block without branching on the comparison result (the offsets are written
+ * unconditionally) and only then swapped, so the comparisons don't suffer from branch mispredictions.
+ */
+template <typename Rng, typename TKey, typename Compare, typename TProj>
+static constexpr std::ptrdiff_t
+block_partition_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, const TKey& pivot, Compare comp, TProj proj) {
+    std::array<std::ptrdiff_t, partition_block_size> offsets_l{};
+    std::array<std::ptrdiff_t, partition_block_size> offsets_r{};
+    std::ptrdiff_t start_l = 0, count_l = 0;
+    std::ptrdiff_t start_r = 0, count_r = 0;
+
+    std::ptrdiff_t l = first;
+    std::ptrdiff_t r = last;
+
+    while (r - l >= 2 * partition_block_size) {
+        if (count_l == 0) {
+            start_l = 0;
+            for (std::ptrdiff_t i = 0; i < partition_block_size; ++i) {
+                offsets_l[count_l] = i;
+                count_l += !std::invoke(comp, proj(rng, l + i), pivot);
+            }
+        }
+        if (count_r == 0) {
+            start_r = 0;
+            for (std::ptrdiff_t i = 0; i < partition_block_size; ++i) {
+                offsets_r[count_r] = i;
+                count_r += std::invoke(comp, proj(rng, r - 1 - i), pivot);
+            }
+        }
+
+        const std::ptrdiff_t count = std::min(count_l, count_r);
+        for (std::ptrdiff_t k = 0; k < count; ++k) {
+            swap_elements(rng, l + offsets_l[start_l + k], r - 1 - offsets_r[start_r + k]);
+        }
+
+        count_l -= count;
+        count_r -= count;
+        start_l += count;
+        start_r += count;
+
+        if (count_l == 0) {
+            l += partition_block_size;
+        }
+        if (count_r == 0) {
+            r -= partition_block_size;
+        }
+    }
+
+    /* Leftovers: everything before `l` is less than the pivot and everything starting from `r` is not. */
+    while (true) {
+        while (l < r && std::invoke(comp, proj(rng, l), pivot)) {
+            ++l;
+        }
+        while (l < r && !std::invoke(comp, proj(rng, r - 1), pivot)) {
+            --r;
+        }
+        if (r - l < 2) {
+            return l;
+        }
+        swap_elements(rng, l++, --r);
+    }
+}
+
 template <typename Rng, typename Compare, typename TProj>
 static constexpr std::pair<std::ptrdiff_t, std::ptrdiff_t>
 partition_pivot_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, TProj proj) {
     const std::ptrdiff_t pivot_pos = median_of_three_unchecked(rng, first, last, comp, proj);
+
+    using key_type = std::remove_cvref_t<decltype(proj(rng, first))>;
+    if constexpr (std::is_arithmetic_v<key_type>) {
+        /* Nothing is less than the pivot (lots of equal keys) - DNF partition below groups them instead. */
+        const key_type pivot = proj(rng, pivot_pos);
+        if (const std::ptrdiff_t mid = block_partition_unchecked(rng, first, last, pivot, comp, proj); mid != first) {
+            return { mid, mid };
+        }
+    }
+
     return dnf_partition_unchecked(rng, first, last, pivot_pos, comp, proj);
 }
 
+/* Insert the element `i` into the sorted range [first, i), returns the number of moved elements */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr std::ptrdiff_t insert_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t i, Compare comp, Proj proj) {
+    using reference_type = typename Rng::reference;
+
+    if (!std::invoke(comp, proj(rng, i), proj(rng, i - 1))) {
+        return 0;
+    }
+
+    std::tuple item_as_tuple = rng[i].steal_into_tuple();
+
+    auto& [... item_members] = item_as_tuple;
+    reference_type item_reference{ item_members... };
+    decltype(auto) item_projected = proj(item_reference);
+
+    std::ptrdiff_t j = i - 1;
+
+    do {
+        rng[j + 1].steal_from(rng[j]);
+        --j;
+    } while (j >= first && std::invoke(comp, item_projected, proj(rng, j)));
+
+    rng[j + 1].steal_from(item_as_tuple);
+    return i - (j + 1);
+}
 
 template <typename Rng, typename Compare, typename Proj>
 static constexpr void insertsort(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, Proj proj) {
-    using reference_type = typename Rng::reference;
+    for (std::ptrdiff_t i = first + 1; i < last; ++i) {
+        insert_unchecked(rng, first, i, comp, proj);
+    }
+}
+
+/* Insertion sort which gives up after `partial_insertion_sort_limit` moves, returns whether the range got sorted */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr bool partial_insertsort_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, Proj proj) {
+    std::ptrdiff_t moved = 0;
 
     for (std::ptrdiff_t i = first + 1; i < last; ++i) {
-        if (std::invoke(comp, proj(rng, i), proj(rng, i - 1))) {
-            std::tuple item_as_tuple = rng[i].steal_into_tuple();
+        moved += insert_unchecked(rng, first, i, comp, proj);
+        if (moved > partial_insertion_sort_limit) {
+            return false;
+        }
+    }
+    return true;
+}
 
-            auto& [... item_members] = item_as_tuple;
-            reference_type item_reference{ item_members... };
-            decltype(auto) item_projected = proj(item_reference);
+/* Reverse [first, last) if it's strictly descending, returns whether it did so */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr bool reverse_if_descending_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, Proj proj) {
+    for (std::ptrdiff_t i = first + 1; i < last; ++i) {
+        if (!std::invoke(comp, proj(rng, i), proj(rng, i - 1))) {
+            return false;
+        }
+    }
 
-            std::ptrdiff_t j = i - 1;
+    for (std::ptrdiff_t l = first, r = last - 1; l < r; ++l, --r) {
+        swap_elements(rng, l, r);
+    }
+    return true;
+}
 
-            do {
-                rng[j + 1].steal_from(rng[j]);
-                --j;
-            } while (j >= first && std::invoke(comp, item_projected, proj(rng, j)));
+/* Swap a few elements around (pdqsort-like) so the input pattern which led to a bad pivot doesn't repeat */
+template <typename Rng>
+static constexpr void break_patterns_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last) {
+    const std::ptrdiff_t size = last - first;
 
-            rng[j + 1].steal_from(item_as_tuple);
+    if (size >= insertion_sort_threshold) {
+        swap_elements(rng, first, first + size / 4);
+        swap_elements(rng, last - 1, last - size / 4);
+        swap_elements(rng, first + size / 2, first + size / 2 + size / 8);
+    }
+}
+
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void
+sift_down_unchecked(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t root, std::ptrdiff_t size, Compare comp, Proj proj) {
+    while (true) {
+        std::ptrdiff_t child = 2 * root + 1;
+        if (child >= size) {
+            return;
+        }
+        if (child + 1 < size && std::invoke(comp, proj(rng, first + child), proj(rng, first + child + 1))) {
+            ++child;
         }
+        if (!std::invoke(comp, proj(rng, first + root), proj(rng, first + child))) {
+            return;
+        }
+
+        swap_elements(rng, first + root, first + child);
+        root = child;
     }
 }
 
 template <typename Rng, typename Compare, typename Proj>
-static constexpr void heapsort(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, Proj proj) {}
+static constexpr void heapsort(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, Compare comp, Proj proj) {
+    const std::ptrdiff_t size = last - first;
+
+    for (std::ptrdiff_t root = size / 2 - 1; root >= 0; --root) {
+        sift_down_unchecked(rng, first, root, size, comp, proj);
+    }
+
+    for (std::ptrdiff_t heap_size = size - 1; heap_size > 0; --heap_size) {
+        swap_elements(rng, first, first + heap_size);
+        sift_down_unchecked(rng, first, 0, heap_size, comp, proj);
+    }
+}
 
 template <typename Rng, typename Compare, typename Proj>
 static constexpr void
@@ -117,14 +298,28 @@ introsort_loop(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, std::ptrdiff
         }
 
         /* Too many quicksort divisions - probably we keep choosing the bad pivot - fallback to heapsort. */
-        // if (depth_limit == 0) {
-        //     heapsort(rng, first, last, comp, proj);
-        //     return;
-        // }
+        if (depth_limit <= 0) {
+            heapsort(rng, first, last, comp, proj);
+            return;
+        }
+
+        /* Sorted and reversed runs are common in practice - both are detected in linear time (and in O(1) for
+         * random input as the checks bail out on the first mismatch). */
+        if (reverse_if_descending_unchecked(rng, first, last, comp, proj) ||
+            partial_insertsort_unchecked(rng, first, last, comp, proj)) {
+            return;
+        }
 
         /* [pivot, pivot) */
         const auto [pivot_first, pivot_last] = partition_pivot_unchecked(rng, first, last, comp, proj);
 
+        /* Highly unbalanced partition - count it against the depth limit and shuffle the pattern away. */
+        if (std::min(pivot_first - first, last - pivot_last) < (last - first) / 8) {
+            --depth_limit;
+            break_patterns_unchecked(rng, first, pivot_first);
+            break_patterns_unchecked(rng, pivot_last, last);
+        }
+
         /* Recurse on smaller partition (trying to make less recursions).
          * Iterate on bigger partition. */
         if (pivot_first - first < last - pivot_last) {
@@ -137,8 +332,279 @@ introsort_loop(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, std::ptrdiff
     }
 }
 
-static constexpr ptrdiff_t lg(ptrdiff_t n) {
-    return std::bit_width(std::make_unsigned_t<ptrdiff_t>(n)) - 1;
+/* Quickselect: partially sort [first, last) so that `nth` holds the element it would hold if the range was sorted */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void
+nth_element(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t last, std::ptrdiff_t nth, Compare comp, Proj proj) {
+    std::ptrdiff_t depth_limit = lg(last - first) * 2;
+
+    while (last - first > insertion_sort_threshold) {
+        /* Keep choosing the bad pivot - don't go quadratic. */
+        if (depth_limit-- <= 0) {
+            heapsort(rng, first, last, comp, proj);
+            return;
+        }
+
+        /* [pivot, pivot) */
+        const auto [pivot_first, pivot_last] = partition_pivot_unchecked(rng, first, last, comp, proj);
+
+        if (nth < pivot_first) {
+            last = pivot_first;
+        } else if (nth >= pivot_last) {
+            first = pivot_last;
+        } else {
+            return;
+        }
+    }
+
+    insertsort(rng, first, last, comp, proj);
+}
+
+/* Copy of a projected key (bucket references are turned into bucket values) */
+template <typename TProjected>
+static constexpr auto key_copy(TProjected&& projected) {
+    if constexpr (requires { projected.into(); }) {
+        return projected.into();
+    } else {
+        return std::remove_cvref_t<TProjected>(projected);
+    }
+}
+
+/* `mrf::vector` itself or the one underlying `mrf::vector<T>::view<Ids...>()` */
+template <typename Rng>
+static constexpr auto& underlying_vector(Rng& rng) {
+    if constexpr (requires { rng.base(); }) {
+        return rng.base();
+    } else {
+        return rng;
+    }
+}
+
+template <typename Rng, typename Proj>
+static constexpr auto extract_keys(Rng& rng, Proj proj) {
+    using key_type = decltype(key_copy(proj(rng, std::size_t{ 0 })));
+
+    std::vector<std::pair<key_type, std::size_t>> keys;
+    keys.reserve(rng.size());
+
+    for (std::size_t idx = 0; idx < rng.size(); ++idx) {
+        keys.emplace_back(key_copy(proj(rng, idx)), idx);
+    }
+    return keys;
+}
+
+template <typename Rng, typename TKeys>
+static constexpr void apply_order(Rng& rng, const TKeys& sorted_keys) {
+    std::vector<std::size_t> order;
+    order.reserve(sorted_keys.size());
+    std::ranges::transform(sorted_keys, std::back_inserter(order), [](const auto& key) { return key.second; });
+
+    underlying_vector(rng).permute(order);
+}
+
+/* Stable bottom-up merge sort of the (key, row index) pairs - the only scratch buffer is a single key column */
+template <typename TKeys, typename Compare>
+static constexpr void merge_sort(TKeys& keys, Compare comp) {
+    const auto by_key = [&comp](const auto& lhs, const auto& rhs) { return std::invoke(comp, lhs.first, rhs.first); };
+    const std::size_t size = keys.size();
+    const auto at = [&keys](std::size_t idx) { return keys.begin() + std::ptrdiff_t(idx); };
+
+    /* Short runs are sorted with (stable) binary insertion sort */
+    constexpr std::size_t run_size = insertion_sort_threshold;
+    for (std::size_t first = 0; first < size; first += run_size) {
+        const std::size_t last = std::min(first + run_size, size);
+        for (std::size_t i = first + 1; i < last; ++i) {
+            std::rotate(std::upper_bound(at(first), at(i), keys[i], by_key), at(i), at(i + 1));
+        }
+    }
+
+    TKeys scratch;
+    scratch.reserve(size);
+
+    for (std::size_t width = run_size; width < size; width *= 2) {
+        scratch.clear();
+        for (std::size_t first = 0; first < size; first += 2 * width) {
+            const std::size_t mid = std::min(first + width, size);
+            const std::size_t last = std::min(first + 2 * width, size);
+
+            std::merge(std::make_move_iterator(at(first)), std::make_move_iterator(at(mid)),
+                std::make_move_iterator(at(mid)), std::make_move_iterator(at(last)), std::back_inserter(scratch), by_key);
+        }
+        keys.swap(scratch);
+    }
+}
+
+/* (key, row index) pairs presented as a range the sorting algorithms work with (see `mrf::cache_keys`) */
+template <typename TKey>
+struct key_column {
+    struct reference {
+        TKey& key;
+        std::size_t& idx;
+
+        constexpr std::tuple<TKey, std::size_t> steal_into_tuple() {
+            return { std::move(key), idx };
+        }
+
+        constexpr void steal_from(reference that) {
+            key = std::move(that.key);
+            idx = that.idx;
+        }
+
+        constexpr void steal_from(std::tuple<TKey, std::size_t>& that) {
+            key = std::move(std::get<0>(that));
+            idx = std::get<1>(that);
+        }
+    };
+
+    constexpr reference operator[](std::size_t idx) {
+        return { keys[idx].first, keys[idx].second };
+    }
+
+    constexpr std::size_t size() const {
+        return keys.size();
+    }
+
+    std::vector<std::pair<TKey, std::size_t>> keys;
+};
+
+/* Projection of `key_column` - the cached key */
+struct key_column_proj {
+    template <typename TKey>
+    static constexpr TKey& operator()(key_column<TKey>& column, std::size_t idx) {
+        return column.keys[idx].first;
+    }
+
+    template <typename TReference>
+        requires requires(TReference& ref) { ref.key; }
+    static constexpr auto& operator()(TReference& ref) {
+        return ref.key;
+    }
+};
+
+/* Default accumulator of `mrf::sum`: 64-bit for integral values (no overflow of narrow columns), double for floating point */
+template <typename T>
+using sum_accumulator_t = std::conditional_t<std::is_floating_point_v<T>, double,
+    std::conditional_t<std::is_integral_v<T>, std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>, T>>;
+
+/* Number of independent accumulators of the reductions (`mrf::reduce`, `mrf::sum`, ...) */
+static constexpr std::size_t reduction_lanes = 8;
+
+/**
+ * Reduce the projected values of all rows (at least one) lifted into `TAcc`. The rows are processed in blocks of
+ * `reduction_lanes` with an accumulator per lane: without the loop-carried dependency on a single accumulator the
+ * compiler vectorizes the loop, over a dedicated column as well as strided over a shared bucket. `op` is assumed
+ * to be associative and commutative (as for `std::reduce`).
+ */
+template <typename TAcc, typename Rng, typename Proj, typename TLift, typename TOp>
+static constexpr TAcc reduce_lanes(Rng& rng, Proj proj, TLift lift, TOp op) {
+    constexpr std::size_t lanes = reduction_lanes;
+    const std::size_t size = rng.size();
+
+    if (size < lanes) {
+        TAcc result = lift(proj(rng, 0));
+        for (std::size_t idx = 1; idx < size; ++idx) {
+            result = op(result, lift(proj(rng, idx)));
+        }
+        return result;
+    }
+
+    const std::size_t blocked = size - size % lanes;
+
+    std::array<TAcc, lanes> acc{};
+    for (std::size_t lane = 0; lane < lanes; ++lane) {
+        acc[lane] = lift(proj(rng, lane));
+    }
+    for (std::size_t idx = lanes; idx < blocked; idx += lanes) {
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            acc[lane] = op(acc[lane], lift(proj(rng, idx + lane)));
+        }
+    }
+
+    TAcc result = acc[0];
+    for (std::size_t lane = 1; lane < lanes; ++lane) {
+        result = op(result, acc[lane]);
+    }
+    for (std::size_t idx = blocked; idx < size; ++idx) {
+        result = op(result, lift(proj(rng, idx)));
+    }
+    return result;
+}
+
+/* Rows are selected (`mrf::select`) in blocks of that many rows */
+static constexpr std::size_t selection_block_size = 256;
+
+/**
+ * Order preserving transform of a key into an unsigned integer: unsigned as is, signed with the sign bit flipped,
+ * floating point with the sign bit flipped (non-negative) or all the bits flipped (negative).
+ */
+template <cpt::radix_key TKey>
+static constexpr auto radix_transform(TKey key) {
+    if constexpr (std::is_enum_v<TKey>) {
+        return radix_transform(std::to_underlying(key));
+    } else if constexpr (std::is_same_v<TKey, bool>) {
+        return std::uint8_t(key);
+    } else if constexpr (std::is_integral_v<TKey>) {
+        using unsigned_type = std::make_unsigned_t<TKey>;
+        constexpr unsigned_type sign_bit = std::is_signed_v<TKey> ? unsigned_type(1) << (sizeof(TKey) * 8 - 1) : 0;
+
+        return unsigned_type(unsigned_type(key) ^ sign_bit);
+    } else {
+        using unsigned_type = std::conditional_t<sizeof(TKey) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        constexpr unsigned_type sign_bit = unsigned_type(1) << (sizeof(TKey) * 8 - 1);
+
+        const auto bits = std::bit_cast<unsigned_type>(key);
+        return unsigned_type((bits & sign_bit) ? ~bits : (bits | sign_bit));
+    }
+}
+
+/* Below that many keys a comparison sort of (key, index) pairs beats the histogram passes */
+static constexpr std::size_t radix_sort_threshold = 256;
+
+/* Stable LSD radix sort of (unsigned key, row index) pairs by 8-bit digits */
+template <typename TRadix>
+static constexpr void lsd_radix_sort(std::vector<std::pair<TRadix, std::size_t>>& keys) {
+    constexpr std::size_t digit_bits = 8;
+    constexpr std::size_t digit_count = std::size_t(1) << digit_bits;
+    constexpr std::size_t passes = sizeof(TRadix);
+
+    const auto digit_of = [](TRadix key, std::size_t pass) {
+        return std::size_t(key >> (pass * digit_bits)) & (digit_count - 1);
+    };
+
+    if (keys.size() < radix_sort_threshold) {
+        /* Row indices are unique - comparing whole pairs keeps it stable */
+        std::ranges::sort(keys);
+        return;
+    }
+
+    /* Histograms of all the passes are collected in a single sweep */
+    std::array<std::array<std::size_t, digit_count>, passes> histograms{};
+    for (const auto& key : keys) {
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            ++histograms[pass][digit_of(key.first, pass)];
+        }
+    }
+
+    std::vector<std::pair<TRadix, std::size_t>> scratch(keys.size());
+
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        auto& histogram = histograms[pass];
+
+        /* All keys share the digit (e.g. high bytes of small ids) - nothing to do in this pass */
+        if (histogram[digit_of(keys.front().first, pass)] == keys.size()) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& count : histogram) {
+            offset += std::exchange(count, offset);
+        }
+
+        for (const auto& key : keys) {
+            scratch[histogram[digit_of(key.first, pass)]++] = key;
+        }
+        keys.swap(scratch);
+    }
 }
 
 template <typename Rng, typename Compare, typename Proj>
@@ -150,13 +616,299 @@ static constexpr void introsort(Rng& rng, std::ptrdiff_t first, std::ptrdiff_t l
 }
 } // namespace impl
 
+/**
+ * In-place sorts move whole rows. Sorting `mrf::vector<T>::view<Ids...>()` sorts the underlying vector (all the
+ * buckets) by the keys projected through the view - swapping only the viewed buckets would tear the rows apart.
+ */
 template <typename Rng, typename Compare, typename Proj>
 static constexpr void introsort(Rng& rng, Compare comp, Proj proj) {
-    impl::introsort(rng, 0, rng.size(), comp, proj);
+    auto& rows = impl::underlying_vector(rng);
+    impl::introsort(rows, 0, rows.size(), comp, proj);
 }
 
 template <typename Rng, typename Compare, typename Proj>
 static constexpr void insertsort(Rng& rng, Compare comp, Proj proj) {
-    impl::insertsort(rng, 0, rng.size(), comp, proj);
+    auto& rows = impl::underlying_vector(rng);
+    impl::insertsort(rows, 0, rows.size(), comp, proj);
+}
+
+/**
+ * Tag selecting the key caching (Schwartzian transform) versions of the sorting algorithms. The projection is
+ * evaluated exactly once per row up front and the algorithm runs over the (key, row index) pairs; every bucket is
+ * then gathered into the sorted order (see `mrf::permutation_sort`). Pays off for expensive projections (tuples of
+ * strings, `proj::bucket`, computed keys).
+ *
+ * mrf::introsort(persons, std::less{}, mrf::proj::bucket<mrf::hot>, mrf::cache_keys);
+ */
+struct cache_keys_t {};
+inline constexpr cache_keys_t cache_keys{};
+
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void introsort(Rng& rng, Compare comp, Proj proj, cache_keys_t) {
+    impl::key_column column{ impl::extract_keys(rng, proj) };
+    impl::introsort(column, 0, column.size(), comp, impl::key_column_proj{});
+    impl::apply_order(rng, column.keys);
+}
+
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void insertsort(Rng& rng, Compare comp, Proj proj, cache_keys_t) {
+    impl::key_column column{ impl::extract_keys(rng, proj) };
+    impl::insertsort(column, 0, column.size(), comp, impl::key_column_proj{});
+    impl::apply_order(rng, column.keys);
+}
+
+/**
+ * Sort without moving rows around while sorting: (key, row index) pairs are extracted and sorted and then every
+ * bucket is gathered into the sorted order in a single linear pass (see `mrf::vector::permute`). Wide rows (cold
+ * buckets not taking part in the comparison) are moved exactly once.
+ *
+ * mrf::permutation_sort(events, std::less{}, mrf::proj::member<^^Event::ts>);
+ *
+ * Sorting `mrf::vector<T>::view<Ids...>()` reads keys through the view but permutes all the buckets.
+ */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void permutation_sort(Rng& rng, Compare comp, Proj proj) {
+    auto keys = impl::extract_keys(rng, proj);
+    std::ranges::sort(keys, comp, [](const auto& key) -> const auto& { return key.first; });
+    impl::apply_order(rng, keys);
+}
+
+/**
+ * Stable sort: equal keys keep their relative order, so multi-pass sorts (by secondary, then by primary key) work.
+ * (key, row index) pairs are merge sorted with a single scratch key column and then every bucket is gathered into
+ * the sorted order (see `mrf::permutation_sort`) - no per-row conversion into `T` and back.
+ *
+ * mrf::stable_sort(persons, std::less{}, mrf::proj::member<^^Person::name>);
+ * mrf::stable_sort(persons, std::less{}, mrf::proj::member<^^Person::age>); // by age, then by name
+ */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void stable_sort(Rng& rng, Compare comp, Proj proj) {
+    auto keys = impl::extract_keys(rng, proj);
+    impl::merge_sort(keys, comp);
+    impl::apply_order(rng, keys);
+}
+
+/**
+ * Stable LSD radix sort for integral, enumeration and floating point keys (ascending). Keys are transformed into
+ * order preserving unsigned integers, (key, row index) pairs are radix sorted and then every bucket is gathered into
+ * the sorted order (see `mrf::permutation_sort`).
+ *
+ * mrf::radix_sort(events, mrf::proj::member<^^Event::ts>);
+ *
+ * Floating point keys are ordered by their bits: -0.0 goes before +0.0 and NaNs go to the ends (by their sign).
+ */
+template <typename Rng, typename Proj>
+static constexpr void radix_sort(Rng& rng, Proj proj) {
+    using key_type = std::remove_cvref_t<decltype(proj(rng, std::size_t{ 0 }))>;
+    static_assert(cpt::radix_key<key_type>, "radix sort key should be integral, enumeration or float/double");
+
+    using radix_type = decltype(impl::radix_transform(std::declval<key_type>()));
+
+    std::vector<std::pair<radix_type, std::size_t>> keys;
+    keys.reserve(rng.size());
+
+    for (std::size_t idx = 0; idx < rng.size(); ++idx) {
+        keys.emplace_back(impl::radix_transform(proj(rng, idx)), idx);
+    }
+
+    impl::lsd_radix_sort(keys);
+    impl::apply_order(rng, keys);
+}
+
+/**
+ * Reorder rows so that the row `nth` is the one which would be there if the whole range was sorted, no row before it
+ * is greater and no row after it is less (quickselect with a heapsort fallback).
+ *
+ * mrf::nth_element(persons, persons.size() / 2, std::less{}, mrf::proj::member<^^Person::age>); // median age
+ */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void nth_element(Rng& rng, std::size_t nth, Compare comp, Proj proj) {
+    auto& rows = impl::underlying_vector(rng);
+    if (nth < rows.size()) {
+        impl::nth_element(rows, 0, rows.size(), nth, comp, proj);
+    }
+}
+
+/**
+ * Sort the smallest `middle` rows into [0, middle), the order of the remaining rows is unspecified.
+ */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr void partial_sort(Rng& rng, std::size_t middle, Compare comp, Proj proj) {
+    auto& rows = impl::underlying_vector(rng);
+    if (middle < rows.size()) {
+        impl::nth_element(rows, 0, rows.size(), middle, comp, proj);
+    }
+    impl::introsort(rows, 0, std::min(middle, rows.size()), comp, proj);
+}
+
+/**
+ * Row indices of the `k` smallest (by `comp`) rows in sorted order. Rows aren't moved (nor keys copied), a heap of `k`
+ * row indices is maintained instead (O(n log k)).
+ *
+ * std::vector<std::size_t> best = mrf::top_k(players, 100, std::greater{}, mrf::proj::member<^^Player::score>);
+ */
+template <typename Rng, typename Compare, typename Proj>
+static constexpr std::vector<std::size_t> top_k(Rng& rng, std::size_t k, Compare comp, Proj proj) {
+    const auto by_key = [&](std::size_t lhs, std::size_t rhs) { return std::invoke(comp, proj(rng, lhs), proj(rng, rhs)); };
+
+    /* Max-heap (by `comp`) - the worst of the best `k` rows is on top */
+    std::vector<std::size_t> heap;
+    heap.reserve(std::min(k, rng.size()));
+
+    for (std::size_t idx = 0; k != 0 && idx < rng.size(); ++idx) {
+        if (heap.size() < k) {
+            heap.push_back(idx);
+            std::ranges::push_heap(heap, by_key);
+        } else if (by_key(idx, heap.front())) {
+            std::ranges::pop_heap(heap, by_key);
+            heap.back() = idx;
+            std::ranges::push_heap(heap, by_key);
+        }
+    }
+
+    std::ranges::sort_heap(heap, by_key);
+    return heap;
+}
+
+/**
+ * Reduction of a member column (or any projection) of all rows, `op` should be associative and commutative:
+ * the rows are accumulated in independent lanes (see `impl::reduce_lanes`) so the order of operations is
+ * unspecified, like for `std::reduce`.
+ *
+ * std::int64_t total = mrf::reduce(orders, std::int64_t{ 0 }, std::plus{}, mrf::proj::member<^^Order::quantity>);
+ */
+template <typename Rng, typename T, typename BinaryOp, typename Proj>
+static constexpr T reduce(Rng& rng, T init, BinaryOp op, Proj proj) {
+    if (rng.size() == 0) {
+        return init;
+    }
+
+    const auto lift = [](const auto& value) { return T(value); };
+    const auto fold = [&op](const T& lhs, const T& rhs) { return T(std::invoke(op, lhs, rhs)); };
+    return fold(init, impl::reduce_lanes<T>(rng, proj, lift, fold));
+}
+
+/**
+ * Sum of the projected values, accumulated in `TAcc`. By default `std::int64_t` (`std::uint64_t`) for signed
+ * (unsigned) integral members, `double` for floating point ones and the type of the member otherwise.
+ *
+ * std::int64_t total = mrf::sum(packets, mrf::proj::member<^^Packet::length>);
+ * float total = mrf::sum<float>(particles, mrf::proj::member<^^Particle::mass>);
+ */
+template <typename TAcc = void, typename Rng, typename Proj>
+static constexpr auto sum(Rng& rng, Proj proj) {
+    using value_type = std::remove_cvref_t<decltype(proj(rng, std::size_t{ 0 }))>;
+    using acc_type = std::conditional_t<std::is_void_v<TAcc>, impl::sum_accumulator_t<value_type>, TAcc>;
+
+    return reduce(rng, acc_type{}, std::plus{}, proj);
+}
+
+/**
+ * Arithmetic mean of the projected values (computed in double), the range should not be empty.
+ */
+template <typename Rng, typename Proj>
+static constexpr double mean(Rng& rng, Proj proj) {
+    return sum<double>(rng, proj) / double(rng.size());
+}
+
+/**
+ * The smallest and the largest projected value, the range should not be empty.
+ *
+ * auto [lowest, highest] = mrf::minmax(readings, mrf::proj::member<^^Reading::value>);
+ */
+template <typename Rng, typename Proj>
+static constexpr auto minmax(Rng& rng, Proj proj) {
+    using value_type = std::remove_cvref_t<decltype(proj(rng, std::size_t{ 0 }))>;
+    using result_type = std::ranges::minmax_result<value_type>;
+
+    assert(rng.size() != 0);
+
+    const auto lift = [](const value_type& value) { return result_type{ value, value }; };
+    const auto merge = [](const result_type& lhs, const result_type& rhs) {
+        return result_type{ rhs.min < lhs.min ? rhs.min : lhs.min, lhs.max < rhs.max ? rhs.max : lhs.max };
+    };
+    return impl::reduce_lanes<result_type>(rng, proj, lift, merge);
+}
+
+/**
+ * Number of rows whose projected value satisfies `pred` (evaluated for every row, without branching on the result).
+ *
+ * std::size_t adults = mrf::count_if(persons, [](int age) { return age >= 18; }, mrf::proj::member<^^Person::age>);
+ */
+template <typename Rng, typename Pred, typename Proj>
+static constexpr std::size_t count_if(Rng& rng, Pred pred, Proj proj) {
+    if (rng.size() == 0) {
+        return 0;
+    }
+
+    const auto lift = [&pred](const auto& value) { return std::size_t(bool(std::invoke(pred, value))); };
+    return impl::reduce_lanes<std::size_t>(rng, proj, lift, std::plus{});
+}
+
+/**
+ * Selection vector: ascending indices of the rows whose projected value satisfies `pred`. The rows are processed in
+ * blocks and the indices are compressed without branching on the predicate (the index is always written, the output
+ * position advances by the result). Consumed by `mrf::vector::gather` and `mrf::vector::erase_rows`.
+ *
+ * std::vector<std::size_t> adults = mrf::select(persons, [](int age) { return age >= 18; }, mrf::proj::member<^^Person::age>);
+ */
+template <typename Rng, typename Pred, typename Proj>
+static constexpr std::vector<std::size_t> select(Rng& rng, Pred pred, Proj proj) {
+    constexpr std::size_t block_size = impl::selection_block_size;
+    const std::size_t size = rng.size();
+
+    std::vector<std::size_t> selection;
+    std::array<std::size_t, block_size> block{};
+
+    for (std::size_t first = 0; first < size; first += block_size) {
+        const std::size_t last = std::min(first + block_size, size);
+
+        std::size_t count = 0;
+        for (std::size_t idx = first; idx < last; ++idx) {
+            block[count] = idx;
+            count += bool(std::invoke(pred, proj(rng, idx)));
+        }
+        selection.insert(selection.end(), block.begin(), block.begin() + std::ptrdiff_t(count));
+    }
+    return selection;
+}
+
+/**
+ * Same as `mrf::select` but the selection is a bitmap: bit `idx % 64` of the word `idx / 64` is set for the selected
+ * rows (1 bit per row, cheap to combine with `&`/`|`). See `mrf::selection_of` for the conversion.
+ */
+template <typename Rng, typename Pred, typename Proj>
+static constexpr std::vector<std::uint64_t> select_bitmap(Rng& rng, Pred pred, Proj proj) {
+    constexpr std::size_t word_bits = 64;
+    const std::size_t size = rng.size();
+
+    std::vector<std::uint64_t> bitmap((size + word_bits - 1) / word_bits);
+
+    for (std::size_t word = 0; word < bitmap.size(); ++word) {
+        const std::size_t first = word * word_bits;
+        const std::size_t last = std::min(first + word_bits, size);
+
+        std::uint64_t bits = 0;
+        for (std::size_t idx = first; idx < last; ++idx) {
+            bits |= std::uint64_t(bool(std::invoke(pred, proj(rng, idx)))) << (idx - first);
+        }
+        bitmap[word] = bits;
+    }
+    return bitmap;
+}
+
+/**
+ * Selection vector of a bitmap of `mrf::select_bitmap`.
+ */
+static constexpr std::vector<std::size_t> selection_of(std::span<const std::uint64_t> bitmap) {
+    constexpr std::size_t word_bits = 64;
+
+    std::vector<std::size_t> selection;
+    for (std::size_t word = 0; word < bitmap.size(); ++word) {
+        for (std::uint64_t bits = bitmap[word]; bits != 0; bits &= bits - 1) {
+            selection.push_back(word * word_bits + std::size_t(std::countr_zero(bits)));
+        }
+    }
+    return selection;
 }
 } // namespace mrf
\ No newline at end of file
@@ -1,5 +1,7 @@
 #pragma once
 #include "morfo/type_traits.hpp"
+#include <bit>
+#include <cstddef>
 #include <meta>
 
 namespace mrf {
@@ -29,6 +31,61 @@ inline constexpr auto hot = tag<hot_tag>;
 inline constexpr auto cold = tag<cold_tag>;
 inline constexpr auto archive = tag<archive_tag>;
 
+template <std::size_t Alignment>
+struct bucket_align {};
+
+/**
+ * Annotation which guarantees the alignment of the bucket's base address. The capacity of `mrf::vector` is padded so
+ * that every aligned bucket array spans a whole number of `Alignment`-sized blocks.
+ * Annotating the struct itself aligns every bucket.
+ *
+ * struct Person {
+ *      [[= mrf::align<64>]] int age{};     // `mrf::bucket<Person, ^^Person::age>` array starts at 64-byte boundary
+ *      std::string name{};
+ * }
+ */
+template <std::size_t Alignment>
+    requires(std::has_single_bit(Alignment))
+inline constexpr bucket_align<Alignment> align;
+
+template <std::size_t TileSize>
+struct bucket_tiling {};
+
+/**
+ * Annotation which stores the bucket in AoSoA layout: rows are grouped in tiles of `TileSize` rows where each member
+ * is stored as `TileSize` contiguous lanes (x[N], y[N], z[N], x[N], ...). Annotating the struct itself tiles every
+ * bucket. Members of an AoSoA bucket should be default constructible.
+ *
+ * struct Particle {
+ *      [[= mrf::hot, = mrf::aosoa<8>]] float x{}; // `mrf::bucket<Particle, mrf::hot>` is stored in tiles of 8 rows
+ *      [[= mrf::hot]] float y{};
+ *      [[= mrf::hot]] float z{};
+ *      std::string name{};
+ * }
+ */
+template <std::size_t TileSize>
+    requires(TileSize > 0)
+inline constexpr bucket_tiling<TileSize> aosoa;
+
+template <typename Policy>
+struct storage_policy {};
+
+struct contiguous_policy;
+
+/**
+ * Annotation of struct `T` which carves the arrays of all buckets out of a single allocation: whenever
+ * `mrf::vector<T>` grows (`reserve`, `push_back`, ...) it allocates one block and every bucket array becomes a slice
+ * of it at its own offset. Buckets are still `std::vector`s (with `mrf::misc::arena_allocator`). During constant
+ * evaluation every bucket allocates separately.
+ *
+ * struct [[= mrf::contiguous]] Sample {
+ *      [[= mrf::align<64>]] float value{};  // one allocation per growth for all three buckets
+ *      std::uint32_t sensor{};
+ *      std::uint64_t timestamp{};
+ * }
+ */
+inline constexpr storage_policy<contiguous_policy> contiguous;
+
 namespace cpt {
 /**
  * Annotated bucket. `mrf::bucket<Person, mrf::hot>`
@@ -2,6 +2,7 @@
 #include <cstddef>
 #include <meta>
 #include <algorithm>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -79,4 +80,17 @@ struct always_false {
     static constexpr bool value = false;
 };
 
+/**
+ * Converts into the result of `fn()`. Passed to `emplace_back` & co. it makes the container initialize the new
+ * element with the returned prvalue directly (guaranteed copy elision) - aggregates get constructed in place.
+ */
+template <typename Fn>
+struct construct_with {
+    Fn fn;
+
+    constexpr operator std::invoke_result_t<Fn&>() {
+        return fn();
+    }
+};
+
 } // namespace mrf::misc
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace mrf::misc {
+
+/**
+ * Allocator adaptor which over-aligns the base address of every allocation to `Alignment` bytes.
+ * Memory is requested from `TAlloc` in `Alignment`-sized (and -aligned) blocks so it works with any allocator
+ * which respects the alignment of its value type (`std::allocator`, `std::pmr::polymorphic_allocator`, ...).
+ */
+template <typename TAlloc, std::size_t Alignment>
+class aligned_allocator {
+    template <typename UAlloc, std::size_t UAlignment>
+    friend class aligned_allocator;
+
+    using traits = std::allocator_traits<TAlloc>;
+
+    struct alignas(Alignment) block {
+        std::byte bytes[Alignment];
+    };
+    using block_allocator = typename traits::template rebind_alloc<block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+public:
+    using value_type = typename traits::value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = typename traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename traits::propagate_on_container_swap;
+    using is_always_equal = typename traits::is_always_equal;
+
+    template <typename U>
+    struct rebind {
+        using other = aligned_allocator<typename traits::template rebind_alloc<U>, Alignment>;
+    };
+
+    constexpr aligned_allocator() = default;
+
+    template <typename UAlloc>
+        requires std::is_constructible_v<TAlloc, const UAlloc&>
+    constexpr aligned_allocator(const UAlloc& alloc)
+        : alloc(alloc) {}
+
+    template <typename UAlloc>
+    constexpr aligned_allocator(const aligned_allocator<UAlloc, Alignment>& that)
+        : alloc(that.alloc) {}
+
+    constexpr value_type* allocate(std::size_t n) {
+        /* Alignment is meaningless (and `reinterpret_cast` is not allowed) during constant evaluation. */
+        if consteval {
+            return std::allocator<value_type>{}.allocate(n);
+        } else {
+            block_allocator blocks(alloc);
+            return static_cast<value_type*>(static_cast<void*>(block_traits::allocate(blocks, blocks_count(n))));
+        }
+    }
+
+    constexpr void deallocate(value_type* ptr, std::size_t n) {
+        if consteval {
+            std::allocator<value_type>{}.deallocate(ptr, n);
+        } else {
+            block_allocator blocks(alloc);
+            block_traits::deallocate(blocks, static_cast<block*>(static_cast<void*>(ptr)), blocks_count(n));
+        }
+    }
+
+    template <typename U, typename... Args>
+    constexpr void construct(U* ptr, Args&&... args) {
+        traits::construct(alloc, ptr, std::forward<Args>(args)...);
+    }
+
+    constexpr aligned_allocator select_on_container_copy_construction() const {
+        return aligned_allocator(traits::select_on_container_copy_construction(alloc));
+    }
+
+    constexpr const TAlloc& underlying() const {
+        return alloc;
+    }
+
+    constexpr friend bool operator==(const aligned_allocator& l, const aligned_allocator& r) {
+        return l.alloc == r.alloc;
+    }
+
+private:
+    static constexpr std::size_t blocks_count(std::size_t n) {
+        return (n * sizeof(value_type) + sizeof(block) - 1) / sizeof(block);
+    }
+
+    [[no_unique_address]] TAlloc alloc{};
+};
+} // namespace mrf::misc
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace mrf::misc {
+namespace impl {
+/* Placed at the start of every block of `arena_allocator`, counts the slices which still live in it */
+struct arena_block {
+    std::size_t slices;
+    std::size_t units; // size of the block in `arena_block`s (including this header)
+};
+
+/* Free part of a block */
+struct arena_cursor {
+    arena_block* block;
+    std::byte* first;
+    std::byte* last;
+};
+
+/* Block offered to the next `arena_allocator::allocate` on this thread (see `arena::offer`) */
+inline thread_local arena_cursor* offered_arena = nullptr;
+} // namespace impl
+
+/**
+ * Allocator adaptor which carves allocations out of shared blocks: the allocation which follows `arena::offer()` on
+ * the same thread becomes a slice of that arena's block, any other allocation gets a block of its own. A block is
+ * returned to `TAlloc` once its last slice is deallocated. Every slice starts at an `Alignment` boundary and is
+ * preceded by a pointer to its block, so slices of one block may be deallocated in any order and through any copy of
+ * the allocator.
+ * During constant evaluation every allocation goes to `TAlloc` directly.
+ */
+template <typename TAlloc, std::size_t Alignment = alignof(typename std::allocator_traits<TAlloc>::value_type)>
+class arena_allocator {
+    template <typename UAlloc, std::size_t UAlignment>
+    friend class arena_allocator;
+
+    template <typename UAlloc>
+    friend class arena;
+
+    using traits = std::allocator_traits<TAlloc>;
+    using block_allocator = typename traits::template rebind_alloc<impl::arena_block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+public:
+    using value_type = typename traits::value_type;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_copy_assignment = typename traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename traits::propagate_on_container_swap;
+    using is_always_equal = typename traits::is_always_equal;
+
+    template <typename U>
+    struct rebind {
+        using other = arena_allocator<typename traits::template rebind_alloc<U>, Alignment>;
+    };
+
+    static constexpr std::size_t alignment = std::max(Alignment, alignof(value_type));
+
+    constexpr arena_allocator() = default;
+
+    template <typename UAlloc>
+        requires std::is_constructible_v<TAlloc, const UAlloc&>
+    constexpr arena_allocator(const UAlloc& alloc)
+        : alloc(alloc) {}
+
+    template <typename UAlloc>
+    constexpr arena_allocator(const arena_allocator<UAlloc, Alignment>& that)
+        : alloc(that.alloc) {}
+
+    constexpr value_type* allocate(std::size_t n) {
+        if consteval {
+            return traits::allocate(alloc, n);
+        } else {
+            impl::arena_cursor* offered = std::exchange(impl::offered_arena, nullptr);
+            if (offered != nullptr) {
+                if (value_type* slice = carve(*offered, n)) {
+                    return slice;
+                }
+            }
+
+            impl::arena_cursor own = allocate_block(alloc, slice_bytes(n));
+            return carve(own, n);
+        }
+    }
+
+    constexpr void deallocate(value_type* ptr, std::size_t n) {
+        if consteval {
+            traits::deallocate(alloc, ptr, n);
+        } else {
+            impl::arena_block* block = nullptr;
+            std::memcpy(&block, reinterpret_cast<std::byte*>(ptr) - sizeof(block), sizeof(block));
+
+            if (--block->slices == 0) {
+                deallocate_block(alloc, block);
+            }
+        }
+    }
+
+    template <typename U, typename... Args>
+    constexpr void construct(U* ptr, Args&&... args) {
+        traits::construct(alloc, ptr, std::forward<Args>(args)...);
+    }
+
+    constexpr arena_allocator select_on_container_copy_construction() const {
+        return arena_allocator(traits::select_on_container_copy_construction(alloc));
+    }
+
+    constexpr const TAlloc& underlying() const {
+        return alloc;
+    }
+
+    /* Room a slice of `n` elements takes in a block (with the worst case padding) */
+    static constexpr std::size_t slice_bytes(std::size_t n) {
+        return sizeof(impl::arena_block*) + alignment - 1 + n * sizeof(value_type);
+    }
+
+    constexpr friend bool operator==(const arena_allocator& l, const arena_allocator& r) {
+        return l.alloc == r.alloc;
+    }
+
+private:
+    static impl::arena_cursor allocate_block(const TAlloc& alloc, std::size_t bytes) {
+        block_allocator blocks(alloc);
+        const std::size_t units = 1 + (bytes + sizeof(impl::arena_block) - 1) / sizeof(impl::arena_block);
+        auto* block = std::construct_at(block_traits::allocate(blocks, units), impl::arena_block{ 0, units });
+
+        return { block, reinterpret_cast<std::byte*>(block + 1), reinterpret_cast<std::byte*>(block + units) };
+    }
+
+    static void deallocate_block(const TAlloc& alloc, impl::arena_block* block) {
+        block_allocator blocks(alloc);
+        block_traits::deallocate(blocks, block, block->units);
+    }
+
+    /* Next slice of `n` elements from the cursor, nullptr if they don't fit */
+    static value_type* carve(impl::arena_cursor& cursor, std::size_t n) {
+        const auto available = static_cast<std::size_t>(cursor.last - cursor.first);
+        if (available < sizeof(impl::arena_block*)) {
+            return nullptr;
+        }
+
+        void* slice = cursor.first + sizeof(impl::arena_block*);
+        std::size_t space = available - sizeof(impl::arena_block*);
+        if (std::align(alignment, n * sizeof(value_type), slice, space) == nullptr) {
+            return nullptr;
+        }
+
+        std::byte* first = static_cast<std::byte*>(slice);
+        std::memcpy(first - sizeof(impl::arena_block*), &cursor.block, sizeof(impl::arena_block*));
+        cursor.first = first + n * sizeof(value_type);
+        ++cursor.block->slices;
+
+        return static_cast<value_type*>(slice);
+    }
+
+    [[no_unique_address]] TAlloc alloc{};
+};
+
+/**
+ * Block of `bytes` bytes shared by the allocations of `arena_allocator`s which follow `offer()` on this thread
+ * (one slice per `offer()`). The block lives until its last slice is deallocated, a block nobody took a slice of is
+ * released by the destructor.
+ *
+ * misc::arena arena(alloc, first_bytes + second_bytes);
+ * arena.offer();
+ * first.reserve(n);  // both `std::vector`s with `arena_allocator` end up in the same block
+ * arena.offer();
+ * second.reserve(n);
+ */
+template <typename TAlloc>
+class arena {
+    using allocator = arena_allocator<TAlloc>;
+
+public:
+    arena(const TAlloc& alloc, std::size_t bytes)
+        : alloc(alloc)
+        , cursor(allocator::allocate_block(alloc, bytes)) {
+        ++cursor.block->slices;
+    }
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    ~arena() {
+        if (impl::offered_arena == &cursor) {
+            impl::offered_arena = nullptr;
+        }
+        if (--cursor.block->slices == 0) {
+            allocator::deallocate_block(alloc, cursor.block);
+        }
+    }
+
+    /* The next `arena_allocator::allocate` on this thread takes its slice from this block (if it fits) */
+    void offer() {
+        impl::offered_arena = &cursor;
+    }
+
+private:
+    [[no_unique_address]] TAlloc alloc;
+    impl::arena_cursor cursor;
+};
+} // namespace mrf::misc
@@ -0,0 +1,62 @@
+#pragma once
+#include "morfo/misc/aligned_allocator.hpp"
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace mrf::misc {
+
+/**
+ * Allocator adaptor which default-initializes (instead of value-initializing) trivially default constructible
+ * elements constructed without arguments, so `std::vector::resize(n)` leaves them uninitialized.
+ * Everything else (allocation, construction with arguments, ...) is forwarded to `TAlloc`.
+ */
+template <typename TAlloc>
+class default_init_allocator : public TAlloc {
+    using traits = std::allocator_traits<TAlloc>;
+
+public:
+    template <typename U>
+    struct rebind {
+        using other = default_init_allocator<typename traits::template rebind_alloc<U>>;
+    };
+
+    constexpr default_init_allocator() = default;
+
+    template <typename UAlloc>
+        requires std::is_constructible_v<TAlloc, const UAlloc&>
+    constexpr default_init_allocator(const UAlloc& alloc)
+        : TAlloc(alloc) {}
+
+    template <typename UAlloc>
+    constexpr default_init_allocator(const default_init_allocator<UAlloc>& that)
+        : TAlloc(that.underlying()) {}
+
+    template <typename U>
+    constexpr void construct(U* ptr) {
+        if constexpr (std::is_trivially_default_constructible_v<U>) {
+            /* Uninitialized objects cannot be read during constant evaluation anyway - value-initialize them there. */
+            if consteval {
+                std::construct_at(ptr);
+            } else {
+                ::new (static_cast<void*>(ptr)) U;
+            }
+        } else {
+            traits::construct(static_cast<TAlloc&>(*this), ptr);
+        }
+    }
+
+    template <typename U, typename... Args>
+    constexpr void construct(U* ptr, Args&&... args) {
+        traits::construct(static_cast<TAlloc&>(*this), ptr, std::forward<Args>(args)...);
+    }
+
+    constexpr default_init_allocator select_on_container_copy_construction() const {
+        return default_init_allocator(traits::select_on_container_copy_construction(underlying()));
+    }
+
+    constexpr const TAlloc& underlying() const {
+        return *this;
+    }
+};
+} // namespace mrf::misc
\ No newline at end of file
@@ -0,0 +1,182 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mrf::misc {
+
+/**
+ * Rows per task of the parallel algorithms. A multiple of 64 and of power-of-two AoSoA tile sizes, so every task
+ * starts on a tile boundary and covers whole cache lines of every bucket: workers writing neighbouring chunks don't
+ * false-share (given cache line aligned bucket arrays, see `mrf::align`).
+ */
+inline constexpr std::size_t parallel_chunk_rows = 4096;
+
+/**
+ * Small work-stealing thread pool backing the parallel algorithms (`mrf::parallel_for_each`, ...).
+ *
+ * Every worker owns a task queue: it pops tasks from the front of its own queue and, once that is empty, steals
+ * from the back of the other queues, so uneven chunks even out. A thread waiting for a batch (`for_each_index`) runs
+ * the queued tasks as well and only blocks once there is nothing left to steal, which also makes nested parallel
+ * calls safe: the tasks of the batch still running are then run by threads which don't wait.
+ */
+class thread_pool {
+public:
+    explicit thread_pool(std::size_t thread_count = std::max(std::thread::hardware_concurrency(), 1u)) {
+        thread_count = std::max<std::size_t>(thread_count, 1);
+
+        for (std::size_t idx = 0; idx < thread_count; ++idx) {
+            queues.push_back(std::make_unique<task_queue>());
+        }
+        for (std::size_t idx = 0; idx < thread_count; ++idx) {
+            workers.emplace_back([this, idx](std::stop_token stop) { worker_loop(stop, idx); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        for (auto& worker : workers) {
+            worker.request_stop();
+        }
+        {
+            std::lock_guard lock(sleep_mutex);
+        }
+        wake.notify_all();
+        workers.clear(); /* joins */
+    }
+
+    /* Number of worker threads */
+    std::size_t size() const {
+        return workers.size();
+    }
+
+    /**
+     * Run `fn(idx)` for every `idx` of [0, count) on the pool and wait until all of them finish. The first exception
+     * thrown by `fn` is rethrown (the remaining tasks still run).
+     */
+    template <typename TFn>
+    void for_each_index(std::size_t count, TFn&& fn) {
+        if (count == 0) {
+            return;
+        }
+
+        std::atomic<std::size_t> left = count;
+        std::exception_ptr error;
+        std::mutex error_mutex;
+
+        /* Set (under `done_mutex`) by the task finishing the batch. The caller takes `done_mutex` before returning,
+         * so the notifying task can't touch the batch state after it is gone. */
+        bool done = false;
+        std::mutex done_mutex;
+        std::condition_variable done_cv;
+
+        /* Counted before any task is queued, so a worker can't pop a task (and decrement `pending`) first */
+        {
+            std::lock_guard lock(sleep_mutex);
+            pending.fetch_add(count, std::memory_order_release);
+        }
+
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            auto& queue = *queues[idx % queues.size()];
+
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.emplace_back([&, idx] {
+                try {
+                    std::invoke(fn, idx);
+                } catch (...) {
+                    std::lock_guard error_lock(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                if (left.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard done_lock(done_mutex);
+                    done = true;
+                    done_cv.notify_all();
+                }
+            });
+        }
+        wake.notify_all();
+
+        /* Help instead of blocking while there is anything to run, then sleep until the running tasks finish */
+        while (left.load(std::memory_order_acquire) != 0 && run_one(0)) {
+        }
+        {
+            std::unique_lock lock(done_mutex);
+            done_cv.wait(lock, [&done] { return done; });
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct task_queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    /* Run a single task - from the front of the queue `own` or stolen from the back of another one */
+    bool run_one(std::size_t own) {
+        std::function<void()> task;
+
+        for (std::size_t k = 0; k < queues.size() && !task; ++k) {
+            auto& queue = *queues[(own + k) % queues.size()];
+
+            std::lock_guard lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                if (k == 0) {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                } else {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+            }
+        }
+
+        if (!task) {
+            return false;
+        }
+
+        pending.fetch_sub(1, std::memory_order_acq_rel);
+        task();
+        return true;
+    }
+
+    void worker_loop(std::stop_token stop, std::size_t idx) {
+        while (!stop.stop_requested()) {
+            if (!run_one(idx)) {
+                std::unique_lock lock(sleep_mutex);
+                wake.wait(lock, stop, [this] { return pending.load(std::memory_order_acquire) != 0; });
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<task_queue>> queues;
+
+    std::mutex sleep_mutex;
+    std::condition_variable_any wake;
+    std::atomic<std::size_t> pending = 0;
+
+    /* Declared last so the workers are joined before the queues are destroyed */
+    std::vector<std::jthread> workers;
+};
+
+/* Process-wide pool used by the parallel algorithms when no pool is given */
+inline thread_pool& default_thread_pool() {
+    static thread_pool pool;
+    return pool;
+}
+} // namespace mrf::misc
\ No newline at end of file
@@ -0,0 +1,233 @@
+#pragma once
+#include "morfo/misc/algorithm.hpp"
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace mrf::misc {
+
+/**
+ * Storage of an AoSoA (`mrf::aosoa<N>`) bucket. Rows are stored in tiles of `TileSize` rows where every member of
+ * the bucket is an array of `TileSize` lanes: x[N], y[N], z[N], x[N], y[N], z[N], ...
+ *
+ * `TTile` declares the same members (in the same order) as `TValue::storage_type` but as `std::array`s.
+ * Unused lanes of the last tile are kept value-initialized.
+ */
+template <typename TValue, typename TTile, std::size_t TileSize, typename TAlloc>
+class tiled_vector {
+    static constexpr auto value_nsdm = misc::nsdm_of<^^typename TValue::storage_type>();
+    static constexpr auto tile_nsdm = misc::nsdm_of<^^TTile>();
+
+    static_assert(value_nsdm.size() == tile_nsdm.size());
+    static_assert(std::is_default_constructible_v<TTile>, "members of AoSoA bucket should be default constructible");
+
+    using tile_allocator = typename std::allocator_traits<TAlloc>::template rebind_alloc<TTile>;
+
+public:
+    using value_type = TValue;
+    using tile_type = TTile;
+    using allocator_type = TAlloc;
+    using size_type = std::size_t;
+
+    static constexpr size_type tile_size = TileSize;
+
+    constexpr tiled_vector() = default;
+    constexpr explicit tiled_vector(const TAlloc& alloc)
+        : tile_storage(tile_allocator(alloc)) {}
+
+    constexpr allocator_type get_allocator() const {
+        return allocator_type(tile_storage.get_allocator());
+    }
+
+    /* Lane of the `ValueMember` (member of `TValue::storage_type`) for the row `idx` */
+    template <std::meta::info ValueMember, typename TSelf>
+    constexpr auto& lane(this TSelf& self, size_type idx) {
+        return lane_at<ValueMember>(self.tile_storage.data(), idx);
+    }
+
+    /* Same as `lane` but given the (cached) base pointer of the tiles */
+    template <std::meta::info ValueMember, typename UTile>
+    static constexpr auto& lane_at(UTile* tiles, size_type idx) {
+        constexpr auto tile_member = tile_nsdm[misc::index_of(value_nsdm, ValueMember)];
+        return tiles[idx / TileSize].[:tile_member:][idx % TileSize];
+    }
+
+    /* Copy of the row `idx` */
+    constexpr value_type get(size_type idx) const {
+        return misc::spread<value_nsdm>([&, this]<std::meta::info... Members> { //
+            return value_type{ { lane<Members>(idx)... } };
+        });
+    }
+
+    /* Move the row `idx` out (lanes are left in a moved-from state) */
+    constexpr value_type take(size_type idx) {
+        return misc::spread<value_nsdm>([&, this]<std::meta::info... Members> { //
+            return value_type{ { std::move(lane<Members>(idx))... } };
+        });
+    }
+
+    template <typename UValue>
+    constexpr void assign(size_type idx, UValue&& value) {
+        template for (constexpr auto member : value_nsdm) {
+            lane<member>(idx) = std::forward_like<UValue>(value.[:member:]);
+        }
+    }
+
+    constexpr void move_element(size_type dst, size_type src) {
+        template for (constexpr auto member : value_nsdm) {
+            lane<member>(dst) = std::move(lane<member>(src));
+        }
+    }
+
+    constexpr void swap_elements(size_type i, size_type j) {
+        template for (constexpr auto member : value_nsdm) {
+            std::ranges::swap(lane<member>(i), lane<member>(j));
+        }
+    }
+
+    constexpr void push_back(const value_type& value) {
+        push_back_impl(value);
+    }
+
+    constexpr void push_back(value_type&& value) {
+        push_back_impl(std::move(value));
+    }
+
+    /* Append a row member-wise: `args` initialize the lanes of the members of `TValue::storage_type` in order */
+    template <typename... UArgs>
+        requires(sizeof...(UArgs) == value_nsdm.size())
+    constexpr void emplace_back(UArgs&&... args) {
+        if (count % TileSize == 0) {
+            tile_storage.push_back(TTile{});
+        }
+        misc::spread<value_nsdm>([&, this]<std::meta::info... Members> { //
+            ((lane<Members>(count) = std::forward<UArgs>(args)), ...);
+        });
+        ++count;
+    }
+
+    /* Insert `value` before the row `idx` shifting the tail up */
+    constexpr void insert(size_type idx, value_type value) {
+        push_back(std::move(value));
+        for (size_type i = count - 1; i > idx; --i) {
+            swap_elements(i, i - 1);
+        }
+    }
+
+    /* Remove rows [first, last) shifting the tail down */
+    constexpr void erase(size_type first, size_type last) {
+        const size_type erased = last - first;
+        for (size_type idx = last; idx < count; ++idx) {
+            move_element(idx - erased, idx);
+        }
+        truncate(count - erased);
+    }
+
+    constexpr void pop_back() {
+        reset(--count);
+        if (count % TileSize == 0) {
+            tile_storage.pop_back();
+        }
+    }
+
+    constexpr void resize(size_type new_size) {
+        resize(new_size, value_type{});
+    }
+
+    constexpr void resize(size_type new_size, const value_type& value) {
+        if (new_size < count) {
+            truncate(new_size);
+        } else {
+            tile_storage.resize(tiles_for(new_size), TTile{});
+            for (size_type idx = count; idx < new_size; ++idx) {
+                assign(idx, value);
+            }
+            count = new_size;
+        }
+    }
+
+    constexpr void reserve(size_type new_cap) {
+        tile_storage.reserve(tiles_for(new_cap));
+    }
+
+    constexpr void shrink_to_fit() {
+        tile_storage.shrink_to_fit();
+    }
+
+    /* Reallocate to exactly `new_cap` rows (rounded up to the whole tile) */
+    constexpr void shrink_to(size_type new_cap) {
+        std::vector<TTile, tile_allocator> shrunk(tile_storage.get_allocator());
+        shrunk.reserve(tiles_for(new_cap));
+        std::ranges::move(tile_storage, std::back_inserter(shrunk));
+        tile_storage.swap(shrunk);
+    }
+
+    constexpr void clear() {
+        tile_storage.clear();
+        count = 0;
+    }
+
+    constexpr void swap(tiled_vector& that) {
+        tile_storage.swap(that.tile_storage);
+        std::ranges::swap(count, that.count);
+    }
+
+    [[nodiscard]] constexpr bool empty() const {
+        return count == 0;
+    }
+
+    constexpr size_type size() const {
+        return count;
+    }
+
+    constexpr size_type capacity() const {
+        return tile_storage.capacity() * TileSize;
+    }
+
+    template <typename TSelf>
+    constexpr auto* data(this TSelf& self) {
+        return self.tile_storage.data();
+    }
+
+    constexpr size_type tile_count() const {
+        return tile_storage.size();
+    }
+
+private:
+    static constexpr size_type tiles_for(size_type rows) {
+        return (rows + TileSize - 1) / TileSize;
+    }
+
+    template <typename UValue>
+    constexpr void push_back_impl(UValue&& value) {
+        if (count % TileSize == 0) {
+            /* Explicit `TTile{}` so that unused lanes are value-initialized even with `default_init_allocator` */
+            tile_storage.push_back(TTile{});
+        }
+        assign(count++, std::forward<UValue>(value));
+    }
+
+    constexpr void truncate(size_type new_size) {
+        for (size_type idx = new_size; idx < count; ++idx) {
+            reset(idx);
+        }
+        tile_storage.resize(tiles_for(new_size), TTile{});
+        count = new_size;
+    }
+
+    constexpr void reset(size_type idx) {
+        template for (constexpr auto member : value_nsdm) {
+            lane<member>(idx) = {};
+        }
+    }
+
+    std::vector<TTile, tile_allocator> tile_storage;
+    size_type count = 0;
+};
+
+template <typename T>
+inline constexpr bool is_tiled_vector_v = false;
+
+template <typename TValue, typename TTile, std::size_t TileSize, typename TAlloc>
+inline constexpr bool is_tiled_vector_v<tiled_vector<TValue, TTile, TileSize, TAlloc>> = true;
+} // namespace mrf::misc
\ No newline at end of file
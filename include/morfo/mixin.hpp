@@ -1,6 +1,7 @@
 #pragma once
 #include "morfo/type_traits.hpp"
 #include <compare>
+#include <span>
 #include <vector>
 
 namespace mrf::mixin {
@@ -154,20 +155,31 @@ struct collect_mixin {
     template <template <typename...> typename TResultContainer = std::vector, typename TSelf>
     constexpr auto collect(this TSelf&& self) {
         using original_type = typename std::remove_cvref_t<TSelf>::original_type;
-        TResultContainer<original_type> result;
 
-        if constexpr (requires { result.reserve(1); }) {
-            result.reserve(self.size());
-        }
+        /* Bulk block-wise transpose (see `mrf::vector::append_into`) */
+        if constexpr (std::is_same_v<TResultContainer<original_type>, std::vector<original_type>> &&
+                      std::is_default_constructible_v<original_type> &&
+                      std::is_assignable_v<original_type&, decltype(std::forward_like<TSelf>(std::declval<original_type&>()))> &&
+                      requires(std::vector<original_type>& out) { std::forward<TSelf>(self).append_into(out); }) {
+            std::vector<original_type> result;
+            std::forward<TSelf>(self).append_into(result);
+            return result;
+        } else {
+            TResultContainer<original_type> result;
+
+            if constexpr (requires { result.reserve(1); }) {
+                result.reserve(self.size());
+            }
 
-        for (auto&& item : self) {
-            if constexpr (requires { result.push_back(std::forward_like<TSelf>(item).forward_into()); }) {
-                result.push_back(std::forward_like<TSelf>(item).forward_into());
-            } else {
-                result.insert(result.end(), std::forward_like<TSelf>(item).forward_into());
+            for (auto&& item : self) {
+                if constexpr (requires { result.push_back(std::forward_like<TSelf>(item).forward_into()); }) {
+                    result.push_back(std::forward_like<TSelf>(item).forward_into());
+                } else {
+                    result.insert(result.end(), std::forward_like<TSelf>(item).forward_into());
+                }
             }
+            return result;
         }
-        return result;
     }
 };
 
@@ -3,9 +3,15 @@
 #include "morfo/bucket.hpp"
 #include "morfo/mixin.hpp"
 #include "morfo/algorithm.hpp"
+#include "morfo/parallel.hpp"
 #include "morfo/projection.hpp"
 #include "morfo/misc/static_vector.hpp"
 #include "morfo/misc/static_map.hpp"
 #include "morfo/misc/unordered_map.hpp"
 #include "morfo/misc/unordered_set.hpp"
-#include "morfo/misc/algorithm.hpp"
\ No newline at end of file
+#include "morfo/misc/algorithm.hpp"
+#include "morfo/misc/aligned_allocator.hpp"
+#include "morfo/misc/arena_allocator.hpp"
+#include "morfo/misc/default_init_allocator.hpp"
+#include "morfo/misc/tiled_vector.hpp"
+#include "morfo/misc/thread_pool.hpp"
\ No newline at end of file
@@ -0,0 +1,343 @@
+#pragma once
+#include "morfo/algorithm.hpp"
+#include "morfo/misc/thread_pool.hpp"
+#include "morfo/vector.hpp"
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <vector>
+
+namespace mrf {
+using thread_pool = misc::thread_pool;
+
+namespace impl {
+/* Run `fn(first, last)` for every chunk of `chunk_rows` rows of [0, size) on `pool` */
+template <typename TFn>
+static void parallel_for_each_range(thread_pool& pool, std::size_t size, std::size_t chunk_rows, TFn&& fn) {
+    const std::size_t chunk_count = (size + chunk_rows - 1) / chunk_rows;
+
+    pool.for_each_index(chunk_count, [&](std::size_t chunk) {
+        const std::size_t first = chunk * chunk_rows;
+        std::invoke(fn, first, std::min(first + chunk_rows, size));
+    });
+}
+
+/* Parallel sort doesn't split the rows into chunks smaller than that */
+static constexpr std::size_t parallel_sort_min_chunk = 4096;
+
+/* Rows [first, last) of the `part`-th out of `parts` nearly equal chunks of [0, size) */
+static constexpr std::pair<std::size_t, std::size_t> chunk_bounds(std::size_t size, std::size_t parts, std::size_t part) {
+    return { size * part / parts, size * (part + 1) / parts };
+}
+
+/* Keys of the rows [first, last) sorted by `comp` */
+template <typename Rng, typename Compare, typename Proj>
+static auto sorted_run(Rng& rng, std::size_t first, std::size_t last, Compare comp, Proj proj) {
+    using key_type = decltype(key_copy(proj(rng, std::size_t{ 0 })));
+
+    std::vector<std::pair<key_type, std::size_t>> run;
+    run.reserve(last - first);
+
+    for (std::size_t idx = first; idx < last; ++idx) {
+        run.emplace_back(key_copy(proj(rng, idx)), idx);
+    }
+
+    std::ranges::sort(run, comp, [](const auto& key) -> const auto& { return key.first; });
+    return run;
+}
+
+/**
+ * Merge path: number of elements of `lhs` among the first `diagonal` elements of the stable merge of `lhs` and
+ * `rhs` (equal keys of `lhs` go first, as with `std::merge`).
+ */
+template <typename TRun, typename TLess>
+static std::size_t merge_path(const TRun& lhs, const TRun& rhs, std::size_t diagonal, TLess by_key) {
+    std::size_t lo = diagonal > rhs.size() ? diagonal - rhs.size() : 0;
+    std::size_t hi = std::min(diagonal, lhs.size());
+
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (by_key(rhs[diagonal - mid - 1], lhs[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Merge sorted runs pairwise until a single one is left. Every merge is split along its merge path into pieces of
+ * about `size / pool.size()` keys, so all the threads of `pool` take part in every round (the last one included).
+ */
+template <typename TRun, typename Compare>
+static TRun merge_runs(std::vector<TRun> runs, Compare comp, thread_pool& pool) {
+    const auto by_key = [&comp](const auto& lhs, const auto& rhs) { return std::invoke(comp, lhs.first, rhs.first); };
+
+    const std::size_t size = std::ranges::fold_left(runs, std::size_t{ 0 }, [](std::size_t acc, const TRun& run) {
+        return acc + run.size();
+    });
+    const std::size_t piece_size = std::max(parallel_sort_min_chunk, (size + pool.size() - 1) / pool.size());
+
+    struct merge_piece {
+        std::size_t merged;    /* index of the merged run (pair of runs 2 * merged, 2 * merged + 1) */
+        std::size_t first;     /* first key of the piece in the merged run */
+        std::size_t last;
+        std::size_t lhs_first; /* first key of the piece in the left run (see `merge_path`) */
+    };
+
+    while (runs.size() > 1) {
+        std::vector<TRun> merged((runs.size() + 1) / 2);
+        std::vector<merge_piece> pieces;
+
+        for (std::size_t i = 0; i + 1 < runs.size(); i += 2) {
+            const std::size_t merged_size = runs[i].size() + runs[i + 1].size();
+            merged[i / 2].resize(merged_size);
+
+            for (std::size_t first = 0; first < merged_size; first += piece_size) {
+                pieces.push_back({ i / 2, first, std::min(first + piece_size, merged_size), 0 });
+            }
+        }
+
+        /* Split points are found before any key is moved out of the runs */
+        pool.for_each_index(pieces.size(), [&](std::size_t idx) {
+            auto& piece = pieces[idx];
+            piece.lhs_first = merge_path(runs[2 * piece.merged], runs[2 * piece.merged + 1], piece.first, by_key);
+        });
+
+        pool.for_each_index(pieces.size(), [&](std::size_t idx) {
+            const auto& piece = pieces[idx];
+            auto& lhs = runs[2 * piece.merged];
+            auto& rhs = runs[2 * piece.merged + 1];
+
+            const bool is_last = idx + 1 == pieces.size() || pieces[idx + 1].merged != piece.merged;
+            const std::size_t lhs_last = is_last ? lhs.size() : pieces[idx + 1].lhs_first;
+
+            std::merge(std::make_move_iterator(lhs.begin() + piece.lhs_first), std::make_move_iterator(lhs.begin() + lhs_last),
+                std::make_move_iterator(rhs.begin() + (piece.first - piece.lhs_first)),
+                std::make_move_iterator(rhs.begin() + (piece.last - lhs_last)), merged[piece.merged].begin() + piece.first,
+                by_key);
+        });
+
+        if (runs.size() % 2 == 1) {
+            merged.back() = std::move(runs.back());
+        }
+        runs = std::move(merged);
+    }
+    return std::move(runs.front());
+}
+
+/* `mrf::impl::apply_order` with the order built and every bucket gathered on `pool` */
+template <typename Rng, typename TKeys>
+static void apply_order(Rng& rng, const TKeys& sorted_keys, thread_pool& pool) {
+    std::vector<std::size_t> order(sorted_keys.size());
+
+    parallel_for_each_range(pool, order.size(), misc::parallel_chunk_rows, [&](std::size_t first, std::size_t last) {
+        for (std::size_t idx = first; idx < last; ++idx) {
+            order[idx] = sorted_keys[idx].second;
+        }
+    });
+    underlying_vector(rng).permute(order, pool);
+}
+
+/* Rows [first, first + count) of a range, see `mrf::parallel_reduce` */
+struct row_range {
+    std::size_t first;
+    std::size_t count;
+
+    constexpr std::size_t size() const {
+        return count;
+    }
+};
+} // namespace impl
+
+/**
+ * Call `fn` with the reference to every row, the rows are split into chunks processed on `pool`. Pass a bucket view
+ * to make the workers touch only the buckets the lambda uses:
+ *
+ * mrf::parallel_for_each(particles.view<mrf::hot>(), [](auto particle) { particle.x += particle.vx; });
+ *
+ * `fn` is called concurrently - it should write only into its own row.
+ */
+template <typename Rng, typename TFn>
+static void parallel_for_each(Rng&& rng, TFn fn, thread_pool& pool) {
+    impl::parallel_for_each_range(pool, rng.size(), misc::parallel_chunk_rows, [&](std::size_t first, std::size_t last) {
+        for (std::size_t idx = first; idx < last; ++idx) {
+            std::invoke(fn, rng[idx]);
+        }
+    });
+}
+
+template <typename Rng, typename TFn>
+static void parallel_for_each(Rng&& rng, TFn fn) {
+    parallel_for_each(std::forward<Rng>(rng), std::move(fn), misc::default_thread_pool());
+}
+
+/**
+ * Parallel `mrf::vector::for_each_chunk`: blocks of `K` rows are passed to `fn` as spans into the buckets `Ids...`
+ * (or all the buckets), whole tasks of blocks are processed on `pool`.
+ *
+ * mrf::parallel_for_each_chunk<256, mrf::hot>(particles, [](std::span<mrf::bucket<Particle, mrf::hot>> hot) { ... });
+ */
+template <std::size_t K, auto... Ids, typename TContainer, typename TFn>
+static void parallel_for_each_chunk(TContainer& container, TFn fn, thread_pool& pool) {
+    constexpr std::size_t chunk_rows = K * std::max<std::size_t>(misc::parallel_chunk_rows / K, 1);
+
+    impl::parallel_for_each_range(pool, container.size(), chunk_rows, [&](std::size_t first, std::size_t last) {
+        container.template for_each_chunk<K, Ids...>(first, last, fn);
+    });
+}
+
+template <std::size_t K, auto... Ids, typename TContainer, typename TFn>
+static void parallel_for_each_chunk(TContainer& container, TFn fn) {
+    parallel_for_each_chunk<K, Ids...>(container, std::move(fn), misc::default_thread_pool());
+}
+
+/**
+ * `out_proj(rng, idx) = op(proj(rng, idx))` for every row, in parallel. Only the buckets of the two projected
+ * members are touched.
+ *
+ * mrf::parallel_transform(particles, mrf::proj::member<^^Particle::speed>, [](float v) { return v * 0.9f; },
+ *                         mrf::proj::member<^^Particle::speed>);
+ */
+template <typename Rng, typename OutProj, typename TOp, typename Proj>
+static void parallel_transform(Rng& rng, OutProj out_proj, TOp op, Proj proj, thread_pool& pool) {
+    impl::parallel_for_each_range(pool, rng.size(), misc::parallel_chunk_rows, [&](std::size_t first, std::size_t last) {
+        for (std::size_t idx = first; idx < last; ++idx) {
+            out_proj(rng, idx) = std::invoke(op, proj(rng, idx));
+        }
+    });
+}
+
+template <typename Rng, typename OutProj, typename TOp, typename Proj>
+static void parallel_transform(Rng& rng, OutProj out_proj, TOp op, Proj proj) {
+    parallel_transform(rng, std::move(out_proj), std::move(op), std::move(proj), misc::default_thread_pool());
+}
+
+/**
+ * Parallel `mrf::reduce`: every chunk is reduced on `pool` (with the vectorizable lane-blocked kernel) and the
+ * partial results are combined on the calling thread. `op` should be associative and commutative.
+ *
+ * double total = mrf::parallel_reduce(particles, 0.0, std::plus{}, mrf::proj::member<^^Particle::mass>);
+ */
+template <typename Rng, typename T, typename BinaryOp, typename Proj>
+static T parallel_reduce(Rng& rng, T init, BinaryOp op, Proj proj, thread_pool& pool) {
+    const std::size_t chunk_rows = misc::parallel_chunk_rows;
+    const std::size_t chunk_count = (rng.size() + chunk_rows - 1) / chunk_rows;
+
+    const auto lift = [](const auto& value) { return T(value); };
+    const auto fold = [&op](const T& lhs, const T& rhs) { return T(std::invoke(op, lhs, rhs)); };
+
+    std::vector<T> partials(chunk_count, init);
+    impl::parallel_for_each_range(pool, rng.size(), chunk_rows, [&](std::size_t first, std::size_t last) {
+        const auto chunk_proj = [&](const impl::row_range& rows, std::size_t idx) -> decltype(auto) {
+            return proj(rng, rows.first + idx);
+        };
+        const impl::row_range rows{ first, last - first };
+        partials[first / chunk_rows] = impl::reduce_lanes<T>(rows, chunk_proj, lift, fold);
+    });
+
+    return std::ranges::fold_left(partials, init, fold);
+}
+
+template <typename Rng, typename T, typename BinaryOp, typename Proj>
+static T parallel_reduce(Rng& rng, T init, BinaryOp op, Proj proj) {
+    return parallel_reduce(rng, std::move(init), std::move(op), std::move(proj), misc::default_thread_pool());
+}
+
+/**
+ * Multi-threaded `mrf::permutation_sort` on `pool`. The rows are split into `pool.size()` chunks and the (key, row
+ * index) pairs of every chunk are extracted and sorted by a task. The sorted runs are merged pairwise, every merge is
+ * split along its merge path into pieces for all the threads. Finally the order is built and every bucket is
+ * gathered by row ranges in parallel (see `mrf::vector::permute(order, pool)`). An exception thrown by `comp` or
+ * `proj` is rethrown on the calling thread.
+ *
+ * mrf::parallel_sort(events, std::less{}, mrf::proj::member<^^Event::ts>);
+ *
+ * Chunks are at least 4096 rows, smaller inputs are sorted on the calling thread. So are keys which aren't default
+ * constructible (merged runs are preallocated).
+ */
+template <typename Rng, typename Compare, typename Proj>
+static void parallel_sort(Rng& rng, Compare comp, Proj proj, thread_pool& pool) {
+    using key_type = decltype(impl::key_copy(proj(rng, std::size_t{ 0 })));
+
+    const std::size_t part_count = std::min(pool.size(), rng.size() / impl::parallel_sort_min_chunk);
+
+    if constexpr (std::default_initializable<key_type>) {
+        if (part_count > 1) {
+            using run_type = decltype(impl::sorted_run(rng, 0, 0, comp, proj));
+
+            std::vector<run_type> runs(part_count);
+            pool.for_each_index(part_count, [&](std::size_t part) {
+                const auto [first, last] = impl::chunk_bounds(rng.size(), part_count, part);
+                runs[part] = impl::sorted_run(rng, first, last, comp, proj);
+            });
+
+            impl::apply_order(rng, impl::merge_runs(std::move(runs), comp, pool), pool);
+            return;
+        }
+    }
+    permutation_sort(rng, comp, proj);
+}
+
+template <typename Rng, typename Compare, typename Proj>
+static void parallel_sort(Rng& rng, Compare comp, Proj proj) {
+    parallel_sort(rng, std::move(comp), std::move(proj), misc::default_thread_pool());
+}
+
+/**
+ * Parallel `mrf::vector::copy_into`: the rows [0, out.size()) are transposed into `out` chunk by chunk on `pool`.
+ *
+ * std::vector<Particle> aos(particles.size());
+ * mrf::parallel_copy_into(particles, std::span(aos));
+ */
+template <typename TContainer, typename T>
+static void parallel_copy_into(const TContainer& container, std::span<T> out, thread_pool& pool) {
+    assert(out.size() <= container.size());
+
+    impl::parallel_for_each_range(pool, out.size(), misc::parallel_chunk_rows, [&](std::size_t first, std::size_t last) {
+        container.copy_into(out.subspan(first, last - first), first);
+    });
+}
+
+template <typename TContainer, typename T>
+static void parallel_copy_into(const TContainer& container, std::span<T> out) {
+    parallel_copy_into(container, out, misc::default_thread_pool());
+}
+
+/**
+ * Parallel `mrf::vector::collect` into `std::vector<T>`: every thread of `pool` appends its part of the rows to a
+ * vector of its own (see `mrf::vector::append_into`) and the parts are then moved after the first one. No row gets
+ * value-initialized on the way.
+ */
+template <typename TContainer>
+static auto parallel_collect(const TContainer& container, thread_pool& pool) {
+    using original_type = typename TContainer::original_type;
+
+    const std::size_t part_count =
+        std::clamp<std::size_t>(container.size() / misc::parallel_chunk_rows, 1, pool.size());
+    std::vector<std::vector<original_type>> parts(part_count);
+
+    pool.for_each_index(part_count, [&](std::size_t part) {
+        const auto [first, last] = impl::chunk_bounds(container.size(), part_count, part);
+        if (part == 0) {
+            parts[part].reserve(container.size());
+        }
+        container.append_into(parts[part], first, last);
+    });
+
+    std::vector<original_type> result = std::move(parts.front());
+    for (auto& part : parts | std::views::drop(1)) {
+        result.insert(result.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+    }
+    return result;
+}
+
+template <typename TContainer>
+static auto parallel_collect(const TContainer& container) {
+    return parallel_collect(container, misc::default_thread_pool());
+}
+} // namespace mrf
\ No newline at end of file
@@ -9,46 +9,70 @@ namespace proj {
 template <auto MetaInfo>
     requires cpt::member_meta<MetaInfo>
 struct member_t {
-    template <typename T>
-    constexpr auto& operator()(mrf::vector<T>& morfo_container, std::size_t idx) {
-        constexpr auto stats = mrf::vector<T>::collect_member_stats();
-        constexpr auto stat = *std::ranges::find(stats, MetaInfo, &mrf::vector<T>::member_stat::item_member);
+    template <typename T, typename Alloc>
+    static constexpr auto& operator()(mrf::vector<T, Alloc>& morfo_container, std::size_t idx) {
+        using vector_type = mrf::vector<T, Alloc>;
+
+        constexpr auto stats = vector_type::collect_member_stats();
+        constexpr auto stat = *std::ranges::find(stats, MetaInfo, &vector_type::member_stat::item_member);
 
-        return morfo_container.storage.[:stat.storage_member:][idx].[:stat.bucket_member:];
+        return vector_type::template member_at<stat>(morfo_container.storage, idx);
     }
 
-    template <typename TRef>
-    constexpr auto& operator()(TRef& ref) {
-        constexpr auto ref_nsdm = misc::nsdm_of(^^typename TRef::storage_type);
-        constexpr auto orig_nsdm = misc::nsdm_of(^^typename TRef::original_type);
+    /* Read-only access (reductions and selections over `const mrf::vector<T>&`) */
+    template <typename T, typename Alloc>
+    static constexpr const auto& operator()(const mrf::vector<T, Alloc>& morfo_container, std::size_t idx) {
+        using vector_type = mrf::vector<T, Alloc>;
 
-        constexpr auto index_of = std::ranges::find(orig_nsdm, MetaInfo) - std::ranges::begin(orig_nsdm);
+        constexpr auto stats = vector_type::collect_member_stats();
+        constexpr auto stat = *std::ranges::find(stats, MetaInfo, &vector_type::member_stat::item_member);
 
-        return ref.[:ref_nsdm[index_of]:];
+        return vector_type::template member_at<stat>(morfo_container.storage, idx);
+    }
+
+    /* `mrf::vector<T>::view<Ids...>()` */
+    template <typename TView>
+        requires requires(TView& view) { view.base(); }
+    static constexpr auto& operator()(TView& view, std::size_t idx) {
+        static_assert(TView::contains(MetaInfo), "member is missing from the view");
+        return operator()(view.base(), idx);
+    }
+
+    /* Members of a reference are references themselves - the reference can be a temporary (e.g. `view[0]`) */
+    template <typename TRef>
+    static constexpr auto& operator()(TRef&& ref) {
+        constexpr auto ref_nsdm = misc::nsdm_of(^^typename std::remove_cvref_t<TRef>::storage_type);
+
+        /* References of views don't cover all the members - find the member by name instead of by index. */
+        return ref.[:*std::ranges::find(ref_nsdm, identifier_of(MetaInfo), &std::meta::identifier_of):];
     }
 };
 
 template <auto Id>
     requires cpt::bucket_id<Id>
 struct bucket_t {
-    template <typename T>
-    constexpr auto operator()(mrf::vector<T>& morfo_container, std::size_t idx) {
-        auto& bucket = morfo_container.template bucket<Id>()[idx];
-        auto& [... members] = bucket;
+    template <typename T, typename Alloc>
+    static constexpr auto operator()(mrf::vector<T, Alloc>& morfo_container, std::size_t idx) {
+        return morfo_container.template bucket_reference_at<Id>(idx);
+    }
 
-        return mrf::bucket_reference<T, Id>{ members... };
+    /* `mrf::vector<T>::view<Ids...>()` */
+    template <typename TView>
+        requires requires(TView& view) { view.base(); }
+    static constexpr auto operator()(TView& view, std::size_t idx) {
+        return operator()(view.base(), idx);
     }
 
     template <typename TRef>
-    constexpr auto operator()(TRef& ref) {
-        using original_type = typename TRef::original_type;
-        using bucket_type = mrf::bucket<original_type, Id>;
-        using bucket_reference = mrf::bucket_reference<original_type, Id>;
+    static constexpr auto operator()(TRef&& ref) {
+        using vector_type = mrf::vector_type_t<TRef>;
+        using bucket_type = typename vector_type::template bucket_type<Id>;
+        using bucket_reference = typename vector_type::template bucket_reference<Id>;
 
         constexpr auto bucket_nsdm = misc::nsdm_of<^^typename bucket_type::storage_type>();
 
         return misc::spread<bucket_nsdm>([&]<auto... BucketMembers>() {
-            constexpr auto ref_nsdm = misc::nsdm_of<^^typename TRef::storage_type>();
+            constexpr auto ref_nsdm = misc::nsdm_of<^^typename std::remove_cvref_t<TRef>::storage_type>();
             return bucket_reference{ ref.[:*std::ranges::find(ref_nsdm, identifier_of(BucketMembers), &std::meta::identifier_of):]... };
         });
     }
@@ -1,10 +1,22 @@
 #pragma once
 #include "morfo/bucket.hpp"
 #include "morfo/misc/algorithm.hpp"
+#include "morfo/misc/aligned_allocator.hpp"
+#include "morfo/misc/arena_allocator.hpp"
+#include "morfo/misc/default_init_allocator.hpp"
 #include "morfo/misc/static_vector.hpp"
+#include "morfo/misc/thread_pool.hpp"
+#include "morfo/misc/tiled_vector.hpp"
 #include "morfo/misc/unordered_map.hpp"
 #include "morfo/mixin.hpp"
 #include <cassert>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <tuple>
 
 namespace mrf {
 namespace proj {
@@ -17,7 +29,19 @@ template <auto Id>
 struct bucket_t;
 } // namespace proj
 
-template <typename T>
+template <typename TContainer>
+class lazy_reference;
+
+/**
+ * Allocator override for a single bucket (see `mrf::bucket_allocator`).
+ */
+template <auto Id, typename TAlloc>
+    requires cpt::bucket_id<Id>
+struct bucket_allocator_t {
+    TAlloc alloc;
+};
+
+template <typename T, typename Alloc = std::allocator<T>>
 class vector : public mrf::mixin::collect_mixin {
     static constexpr std::size_t members_count = nonstatic_data_members_of(^^T, std::meta::access_context::unchecked()).size();
     static_assert(members_count > 0, "type T should have at least one nonstatic data member");
@@ -32,19 +56,56 @@ class vector : public mrf::mixin::collect_mixin {
         requires cpt::bucket_id<Id>
     friend struct proj::bucket_t;
 
+    template <typename TContainer>
+    friend class mrf::lazy_reference;
+
+    template <typename U>
+    using rebind_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+
+    /* `T` itself or a reference into `mrf::vector<T>` (its `value_type` is `T`) */
+    template <typename TItem>
+    static constexpr bool is_row_v = std::same_as<std::remove_cvref_t<TItem>, T> ||
+        requires { requires std::same_as<typename std::remove_cvref_t<TItem>::value_type, T>; };
+
+    /* Rows of `R` are references into `mrf::vector<T, Alloc>` - maybe this very one (`std::views::all(*this)`, ...) */
+    template <typename R>
+    static constexpr bool may_alias_v = requires {
+        requires std::same_as<typename std::remove_cvref_t<std::ranges::range_reference_t<R>>::vector_type, vector>;
+    };
+
     /* These will be defined using reflection */
 private:
     template <auto Id>
     struct bucket_storage_type;
     template <auto Id>
+    struct bucket_tile_storage_type;
+    template <auto Id>
     struct bucket_reference_storage_type;
     template <auto Id>
     struct bucket_const_reference_storage_type;
     struct reference_storage_type;
     struct const_reference_storage_type;
     struct storage_type;
+    struct bucket_pointers_type;
+    struct bucket_const_pointers_type;
     /**/
 
+    /* `args...` are one per member of the aggregate `T` and convertible to them (see `emplace_back`) */
+    template <typename... Args>
+    static constexpr bool is_member_wise_v = [] {
+        if constexpr (!std::is_aggregate_v<T> || sizeof...(Args) != members_count) {
+            return false;
+        } else {
+            return misc::spread<misc::nsdm_of<^^T>()>([]<std::meta::info... Members> {
+                return (std::is_convertible_v<Args, typename[:type_of(Members):]> && ...);
+            });
+        }
+    }();
+
+    /* Element type of a bucket storage (`bucket_type<Id>` or a tile of an AoSoA bucket) */
+    template <typename TBucketStorage>
+    using bucket_element_t = std::remove_pointer_t<decltype(std::declval<TBucketStorage&>().data())>;
+
     struct member_stat {
         std::meta::info item_member;
         std::meta::info bucket_member;
@@ -78,6 +139,89 @@ private:
         return std::meta::reflect_constant(Member);
     }
 
+    /* `mrf::align<N>` annotation of a member (or struct `T` itself), 1 if there is none */
+    template <std::meta::info Entity>
+    static consteval std::size_t get_alignment_annotation() {
+        std::size_t alignment = 1;
+
+        template for (constexpr auto annotation : define_static_array(annotations_of(Entity))) {
+            if constexpr (template_of(type_of(annotation)) == ^^mrf::bucket_align) {
+                alignment = std::max(alignment, extract<std::size_t>(template_arguments_of(type_of(annotation))[0]));
+            }
+        }
+
+        return alignment;
+    }
+
+    /* `mrf::aosoa<N>` annotation of a member (or struct `T` itself), 0 if there is none */
+    template <std::meta::info Entity>
+    static consteval std::size_t get_tiling_annotation() {
+        template for (constexpr auto annotation : define_static_array(annotations_of(Entity))) {
+            if constexpr (template_of(type_of(annotation)) == ^^mrf::bucket_tiling) {
+                return extract<std::size_t>(template_arguments_of(type_of(annotation))[0]);
+            }
+        }
+
+        return 0;
+    }
+
+    /* `mrf::contiguous` annotation of struct `T` */
+    static consteval bool get_contiguous_annotation() {
+        template for (constexpr auto annotation : define_static_array(annotations_of(^^T))) {
+            if constexpr (template_of(type_of(annotation)) == ^^mrf::storage_policy) {
+                if (template_arguments_of(type_of(annotation))[0] == ^^mrf::contiguous_policy) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /* Tile size of an AoSoA bucket, 0 for a regular (AoS within the bucket) one */
+    static consteval std::size_t get_bucket_tile_size(std::meta::info bucket_id) {
+        template for (constexpr auto member : misc::nsdm_of(^^T)) {
+            if (get_bucket_id<member>() == bucket_id && get_tiling_annotation<member>() != 0) {
+                return get_tiling_annotation<member>();
+            }
+        }
+
+        return get_tiling_annotation<^^T>();
+    }
+
+    static consteval std::size_t get_bucket_alignment(std::meta::info bucket_id) {
+        std::size_t alignment = std::max(alignment_of(substitute(^^bucket_type, { bucket_id })), get_alignment_annotation<^^T>());
+
+        template for (constexpr auto member : misc::nsdm_of(^^T)) {
+            if (get_bucket_id<member>() == bucket_id) {
+                alignment = std::max(alignment, get_alignment_annotation<member>());
+            }
+        }
+
+        return alignment;
+    }
+
+    /* Capacity should be a multiple of this so that every over-aligned bucket array ends at its alignment boundary */
+    static consteval std::size_t get_capacity_granularity() {
+        std::size_t granularity = 1;
+
+        template for (constexpr auto member : misc::nsdm_of(^^T)) {
+            const auto bucket_id = get_bucket_id<member>();
+            const std::size_t alignment = get_bucket_alignment(bucket_id);
+
+            if (const std::size_t tile_size = get_bucket_tile_size(bucket_id); tile_size != 0) {
+                /* AoSoA bucket allocates whole tiles */
+                const std::size_t tile_bytes = size_of(substitute(^^bucket_tile_storage_type, { bucket_id }));
+                granularity = std::lcm(granularity, tile_size * (alignment / std::gcd(alignment, tile_bytes)));
+            } else {
+                const std::size_t bucket_size = size_of(substitute(^^bucket_type, { bucket_id }));
+                granularity = std::lcm(granularity, alignment / std::gcd(alignment, bucket_size));
+            }
+        }
+
+        return granularity;
+    }
+
     static consteval void define_bucket_storage_types() {
         misc::unordered_map<std::meta::info, std::vector<std::meta::info>> member_specs;
 
@@ -94,6 +238,28 @@ private:
             [](const auto type_info, const auto member_specs) { define_aggregate(type_info, member_specs); });
     }
 
+    static consteval void define_bucket_tile_types() {
+        misc::unordered_map<std::meta::info, std::vector<std::meta::info>> member_specs;
+
+        template for (constexpr auto member : misc::nsdm_of(^^T)) {
+            constexpr auto bucket_id = get_bucket_id<member>();
+            constexpr std::size_t tile_size = get_bucket_tile_size(bucket_id);
+
+            if constexpr (tile_size != 0) {
+                // clang-format off
+                const auto type_info = substitute(^^bucket_tile_storage_type, { bucket_id });
+                const auto lanes_type = substitute(^^std::array, { type_of(member), std::meta::reflect_constant(tile_size) });
+                const auto member_spec = data_member_spec(lanes_type, { .name = identifier_of(member) });
+                // clang-format on
+
+                member_specs[type_info].push_back(member_spec);
+            }
+        }
+
+        member_specs.foreach (
+            [](const auto type_info, const auto member_specs) { define_aggregate(type_info, member_specs); });
+    }
+
     static consteval void define_bucket_reference_types(std::meta::info ref_type, bool is_const) {
         misc::unordered_map<std::meta::info, std::vector<std::meta::info>> member_specs;
 
@@ -117,9 +283,7 @@ private:
 
         template for (constexpr auto member : misc::nsdm_of(^^T)) {
             // clang-format off
-            constexpr auto bucket_type_info = substitute(^^bucket_type, { get_bucket_id<member>() });
-
-            constexpr auto storage_member_type = substitute(^^std::vector, { bucket_type_info });
+            constexpr auto storage_member_type = dealias(substitute(^^bucket_storage, { get_bucket_id<member>() }));
             constexpr auto storage_member_spec = data_member_spec(storage_member_type);
             // clang-format on
 
@@ -145,6 +309,22 @@ private:
         define_aggregate(ref_type, ref_member_specs);
     }
 
+    /* One (unnamed) base pointer per member of `storage_type` (in the same order) */
+    static consteval void define_bucket_pointers_type(std::meta::info pointers_type, bool is_const) {
+        std::vector<std::meta::info> pointer_member_specs;
+
+        for (const auto storage_member : misc::nsdm_of(^^storage_type)) {
+            // clang-format off
+            const auto element_type = dealias(substitute(^^bucket_element_t, { type_of(storage_member) }));
+            const auto pointer_type = add_pointer(is_const ? add_const(element_type) : element_type);
+            // clang-format on
+
+            pointer_member_specs.push_back(data_member_spec(pointer_type));
+        }
+
+        define_aggregate(pointers_type, pointer_member_specs);
+    }
+
     static consteval auto collect_member_stats() {
         const auto storage_members = misc::nsdm_of(^^storage_type);
         constexpr auto members = misc::nsdm_of(^^T);
@@ -153,9 +333,8 @@ private:
 
         template for (std::size_t idx = 0; constexpr auto member : members) {
             // clang-format off
-            const auto bucket_type_info = substitute(^^bucket_type, { get_bucket_id<member>() });
-            const auto storage_member_type = substitute(^^std::vector, { bucket_type_info });
-            
+            const auto storage_member_type = dealias(substitute(^^bucket_storage, { get_bucket_id<member>() }));
+
             const auto bucket_storage_type_info = substitute(^^bucket_storage_type, { get_bucket_id<member>() });
             const auto bucket_members = misc::nsdm_of(bucket_storage_type_info);
             // clang-format on
@@ -173,6 +352,45 @@ private:
         return stats;
     }
 
+    static consteval bool is_bucket_id(std::meta::info bucket_id) {
+        template for (constexpr auto member : misc::nsdm_of(^^T)) {
+            if (get_bucket_id<member>() == bucket_id) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /* Stats of the members which belong to any of `bucket_ids` buckets (in the order of members of `T`) */
+    static consteval auto collect_view_member_stats(std::initializer_list<std::meta::info> bucket_ids) {
+        misc::static_vector<member_stat, members_count> stats{};
+
+        template for (std::size_t idx = 0; constexpr auto member : misc::nsdm_of(^^T)) {
+            if (std::ranges::contains(bucket_ids, get_bucket_id<member>())) {
+                stats.push_back(member_stats_s[idx]);
+            }
+            ++idx;
+        }
+
+        return stats;
+    }
+
+    static consteval void define_view_reference_type(
+        std::meta::info ref_type, bool is_const, const misc::static_vector<member_stat, members_count>& stats) {
+        std::vector<std::meta::info> ref_member_specs;
+
+        for (std::size_t idx = 0; idx < stats.size; ++idx) {
+            const auto member_type = type_of(stats.data[idx].item_member);
+            const auto ref_member_type = add_lvalue_reference(is_const ? add_const(member_type) : member_type);
+            const auto ref_member_name = identifier_of(stats.data[idx].item_member);
+
+            ref_member_specs.push_back(data_member_spec(ref_member_type, { .name = ref_member_name }));
+        }
+
+        define_aggregate(ref_type, ref_member_specs);
+    }
+
     static consteval auto collect_storage_stats() {
         misc::static_vector<storage_member_stat, members_count> storage_stats{};
 
@@ -181,9 +399,8 @@ private:
 
         template for (constexpr auto member : members) {
             // clang-format off
-            constexpr auto bucket_type_info = substitute(^^bucket_type, { get_bucket_id<member>() });
-            constexpr auto storage_member_type = substitute(^^std::vector, { bucket_type_info });
-            
+            constexpr auto storage_member_type = dealias(substitute(^^bucket_storage, { get_bucket_id<member>() }));
+
             constexpr auto bucket_storage_type_info = substitute(^^bucket_storage_type, { get_bucket_id<member>() });
             constexpr auto bucket_members = misc::nsdm_of(bucket_storage_type_info);
             // clang-format on
@@ -209,6 +426,7 @@ private:
 public:
     consteval {
         define_bucket_storage_types();
+        define_bucket_tile_types();
         define_bucket_reference_types(^^bucket_reference_storage_type, false);
         define_bucket_reference_types(^^bucket_const_reference_storage_type, true);
     }
@@ -220,18 +438,51 @@ public:
                          mrf::mixin::into_mixin,
                          mrf::mixin::cmp_mixin {
         using original_type = T;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = bucket_storage_type<Id>;
     };
 
+    /* Alignment of the bucket's base address (see `mrf::align<N>` annotation) */
+    template <auto Id>
+    static constexpr std::size_t bucket_alignment = get_bucket_alignment(std::meta::reflect_constant(Id));
+
+    /* Rows per tile of an AoSoA bucket (see `mrf::aosoa<N>` annotation), 0 for a regular bucket */
+    template <auto Id>
+    static constexpr std::size_t bucket_tile_size = get_bucket_tile_size(std::meta::reflect_constant(Id));
+
+    /* Arrays of all buckets are slices of one block per growth (see `mrf::contiguous` annotation) */
+    static constexpr bool contiguous_s = get_contiguous_annotation();
+
+    /**
+     * Every bucket is a separate `std::vector` which allocates through the (rebound) `Alloc`. With `mrf::contiguous`
+     * it is wrapped into `misc::arena_allocator` (which aligns the slices as well).
+     */
+    template <auto Id>
+    using bucket_allocator_type = std::conditional_t<contiguous_s,
+        misc::arena_allocator<rebind_alloc<bucket_type<Id>>, bucket_alignment<Id>>,
+        std::conditional_t<(bucket_alignment<Id> > alignof(bucket_type<Id>)),
+            misc::aligned_allocator<rebind_alloc<bucket_type<Id>>, bucket_alignment<Id>>,
+            rebind_alloc<bucket_type<Id>>>>;
+
+    template <auto Id>
+    using bucket_storage = std::conditional_t<bucket_tile_size<Id> == 0,
+        std::vector<bucket_type<Id>, bucket_allocator_type<Id>>,
+        misc::tiled_vector<bucket_type<Id>, bucket_tile_storage_type<Id>, bucket_tile_size<Id>, bucket_allocator_type<Id>>>;
+
     consteval {
         define_storage_type();
         define_reference_type(^^reference_storage_type, false);
         define_reference_type(^^const_reference_storage_type, true);
+        define_bucket_pointers_type(^^bucket_pointers_type, false);
+        define_bucket_pointers_type(^^bucket_const_pointers_type, true);
     }
 
     static constexpr auto member_stats_s = collect_member_stats();
     static constexpr auto storage_stats_s = collect_storage_stats();
+    static constexpr std::size_t capacity_granularity_s = get_capacity_granularity();
+
+    /* `copy_into` transposes blocks of rows of about that many bytes (fits L1 along with the source columns) */
+    static constexpr std::size_t copy_block_bytes_s = 16 * 1024;
 
     template <auto Id>
     struct bucket_const_reference : bucket_const_reference_storage_type<Id>,
@@ -241,7 +492,7 @@ public:
                                     mrf::mixin::cmp_mixin {
         using original_type = T;
         using value_type = bucket_type<Id>;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = bucket_const_reference_storage_type<Id>;
     };
 
@@ -255,7 +506,7 @@ public:
                               mrf::mixin::aggregate_implicit_convert_into_mixin<bucket_const_reference<Id>> {
         using original_type = T;
         using value_type = bucket_type<Id>;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = bucket_reference_storage_type<Id>;
     };
 
@@ -266,7 +517,7 @@ public:
                              mrf::mixin::cmp_mixin {
         using original_type = T;
         using value_type = T;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = const_reference_storage_type;
     };
 
@@ -279,14 +530,14 @@ public:
                        mrf::mixin::aggregate_implicit_convert_into_mixin<const_reference> {
         using original_type = T;
         using value_type = T;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = reference_storage_type;
     };
 
     struct pointer : reference_storage_type {
         using original_type = T;
         using value_type = T;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = reference_storage_type;
 
         constexpr auto operator->() {
@@ -300,7 +551,7 @@ public:
     struct const_pointer : const_reference_storage_type {
         using original_type = T;
         using value_type = T;
-        using vector_type = mrf::vector<T>;
+        using vector_type = vector;
         using storage_type = const_reference_storage_type;
 
         constexpr auto operator->() {
@@ -320,7 +571,7 @@ private:
         friend class ref_iterator;
 
     public:
-        using container_type = std::conditional_t<Kind == iter_kind::constant, const mrf::vector<T>, mrf::vector<T>>;
+        using container_type = std::conditional_t<Kind == iter_kind::constant, const vector, vector>;
         using reference = std::conditional_t<Kind == iter_kind::constant, vector::const_reference, vector::reference>;
         using value_type = reference;
         using size_type = std::size_t;
@@ -344,13 +595,13 @@ private:
 
         constexpr reference operator*() const noexcept {
             return misc::spread<member_stats_s>([this]<member_stat... Stats> {
-                return reference{ container->storage.[:Stats.storage_member:][idx].[:Stats.bucket_member:]... };
+                return reference{ vector::member_at<Stats>(container->storage, idx)... };
             });
         }
 
         constexpr pointer operator->() const noexcept {
             return misc::spread<member_stats_s>([this]<member_stat... Stats> {
-                return pointer{ container->storage.[:Stats.storage_member:][idx].[:Stats.bucket_member:]... };
+                return pointer{ vector::member_at<Stats>(container->storage, idx)... };
             });
         }
 
@@ -469,181 +720,1185 @@ private:
         std::size_t idx = std::numeric_limits<std::size_t>::max();
     };
 
-public:
-    using original_type = T;
-    using value_type = reference;
-    using size_type = std::size_t;
-    using difference_type = std::ptrdiff_t;
-    using iterator = ref_iterator<iter_kind::regular>;
-    using const_iterator = ref_iterator<iter_kind::constant>;
-
-    template <auto Id>
-        requires cpt::bucket_id<Id>
-    constexpr const auto& bucket() const {
-        return bucket_impl<Id>();
-    }
+    /* End of `fast_view` (just the size, no container to compare against) */
+    struct fast_sentinel {
+        std::size_t size = 0;
+    };
 
     /**
-     * Be careful with changing the size of a mutable bucket!
-     * Using mrf::vector while buckets have different size is UB!
+     * Iterator of `fast_view`. Caches the base pointer of every bucket instead of the container pointer so
+     * the compiler doesn't have to reload (and prove no aliasing for) the data pointer of every bucket on each
+     * dereference. Comparison doesn't clamp the indices which keeps the loop trip count obvious.
      */
-    template <auto Id>
-        requires cpt::bucket_id<Id>
-    constexpr auto& bucket() {
-        return bucket_impl<Id>();
-    }
+    template <iter_kind Kind>
+    class fast_iterator {
+    public:
+        using pointers_type = std::conditional_t<Kind == iter_kind::constant, bucket_const_pointers_type, bucket_pointers_type>;
+        using reference = std::conditional_t<Kind == iter_kind::constant, vector::const_reference, vector::reference>;
+        using value_type = reference;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Kind == iter_kind::constant, vector::const_pointer, vector::pointer>;
 
-    constexpr auto begin() {
-        return iterator{ this, 0 };
-    }
+        constexpr fast_iterator() = default;
+        constexpr fast_iterator(const pointers_type& pointers, std::size_t idx)
+            : pointers(pointers)
+            , idx(idx) {}
 
-    constexpr auto end() {
-        return iterator{ this, size() };
-    }
+        constexpr reference operator*() const noexcept {
+            return misc::spread<member_stats_s>([this]<member_stat... Stats> {
+                return reference{ vector::pointer_member_at<Stats>(pointers, idx)... };
+            });
+        }
 
-    constexpr auto begin() const {
-        return const_iterator{ this, 0 };
-    }
+        constexpr pointer operator->() const noexcept {
+            return misc::spread<member_stats_s>([this]<member_stat... Stats> {
+                return pointer{ vector::pointer_member_at<Stats>(pointers, idx)... };
+            });
+        }
 
-    constexpr auto end() const {
-        return const_iterator{ this, size() };
-    }
+        constexpr fast_iterator& operator++() noexcept {
+            ++idx;
+            return *this;
+        }
 
-    constexpr auto cbegin() {
-        return const_iterator{ this, 0 };
-    }
+        constexpr fast_iterator operator++(int) noexcept {
+            const auto copy = *this;
+            ++idx;
+            return copy;
+        }
 
-    constexpr auto cend() {
-        return const_iterator{ this, size() };
-    }
+        constexpr fast_iterator& operator--() noexcept {
+            --idx;
+            return *this;
+        }
 
-    constexpr auto cbegin() const {
-        return const_iterator{ this, 0 };
-    }
+        constexpr fast_iterator operator--(int) noexcept {
+            const auto copy = *this;
+            --idx;
+            return copy;
+        }
 
-    constexpr auto cend() const {
-        return const_iterator{ this, size() };
-    }
+        constexpr fast_iterator& operator-=(difference_type offset) noexcept {
+            idx -= offset;
+            return *this;
+        }
 
-    constexpr void push_back(const T& item) {
-        push_back_impl(item);
-    }
+        constexpr fast_iterator& operator+=(difference_type offset) noexcept {
+            idx += offset;
+            return *this;
+        }
 
-    constexpr void push_back(T&& item) {
-        push_back_impl(std::move(item));
-    }
+        constexpr reference operator[](difference_type offset) const {
+            auto copy = *this;
+            copy += offset;
+            return *copy;
+        }
 
-    constexpr void push_back(const reference& ref) {
-        push_back_ref_impl(ref);
-    }
+    private:
+        constexpr friend auto operator<=>(const fast_iterator& l, const fast_iterator& r) noexcept {
+            return l.idx <=> r.idx;
+        }
 
-    constexpr void push_back(const const_reference& ref) {
-        push_back_ref_impl(ref);
-    }
+        constexpr friend bool operator==(const fast_iterator& l, const fast_iterator& r) noexcept {
+            return l.idx == r.idx;
+        }
 
-    template <typename... Args>
-    constexpr reference emplace_back(Args&&... args) {
-        push_back_impl(T{ std::forward<Args>(args)... });
-        return back();
-    }
+        constexpr friend bool operator==(const fast_iterator& it, const fast_sentinel& sentinel) noexcept {
+            return it.idx == sentinel.size;
+        }
 
-    constexpr reference back() {
-        return *(--end());
-    }
+        constexpr friend fast_iterator operator+(fast_iterator that, difference_type offset) noexcept {
+            that.idx += offset;
+            return that;
+        }
 
-    constexpr const_reference back() const {
-        return *(--end());
-    }
+        constexpr friend fast_iterator operator+(difference_type offset, fast_iterator that) noexcept {
+            that.idx += offset;
+            return that;
+        }
 
-    constexpr reference front() {
-        return *begin();
-    }
+        constexpr friend fast_iterator operator-(fast_iterator that, difference_type offset) noexcept {
+            that.idx -= offset;
+            return that;
+        }
 
-    constexpr const_reference front() const {
-        return *begin();
-    }
+        constexpr friend difference_type operator-(const fast_iterator& l, const fast_iterator& r) noexcept {
+            return difference_type(l.idx) - difference_type(r.idx);
+        }
 
-    constexpr reference operator[](size_type idx) {
-        return *(begin() + idx);
-    }
+        constexpr friend difference_type operator-(const fast_sentinel& sentinel, const fast_iterator& it) noexcept {
+            return difference_type(sentinel.size) - difference_type(it.idx);
+        }
 
-    constexpr const_reference operator[](size_type idx) const {
-        return *(begin() + idx);
-    }
+        constexpr friend difference_type operator-(const fast_iterator& it, const fast_sentinel& sentinel) noexcept {
+            return difference_type(it.idx) - difference_type(sentinel.size);
+        }
 
-    constexpr reference at(size_type idx) {
+    private:
+        pointers_type pointers{};
+        std::size_t idx = 0;
+    };
+
+    template <iter_kind Kind>
+    class fast_view_type : public std::ranges::view_interface<fast_view_type<Kind>> {
+    public:
+        using iterator = fast_iterator<Kind>;
+        using pointers_type = typename iterator::pointers_type;
+
+        constexpr fast_view_type() = default;
+        constexpr fast_view_type(const pointers_type& pointers, std::size_t count)
+            : pointers(pointers)
+            , count(count) {}
+
+        constexpr iterator begin() const {
+            return iterator{ pointers, 0 };
+        }
+
+        constexpr fast_sentinel end() const {
+            return fast_sentinel{ count };
+        }
+
+        constexpr std::size_t size() const {
+            return count;
+        }
+
+    private:
+        pointers_type pointers{};
+        std::size_t count = 0;
+    };
+
+    /**
+     * Rows restricted to the members of `Ids...` buckets (see `view`). Forming a reference of the view never
+     * computes an address within the rest of the buckets.
+     */
+    template <iter_kind Kind, auto... Ids>
+    class bucket_view {
+        static_assert((is_bucket_id(std::meta::reflect_constant(Ids)) && ...),
+            R"(you are trying to get `view<tag>` but corresponding member (or struct `T`) ain't marked with `tag` annotation)");
+
+        static constexpr auto view_member_stats_s = collect_view_member_stats({ std::meta::reflect_constant(Ids)... });
+
+        struct reference_storage_type;
+
+        consteval {
+            define_view_reference_type(^^reference_storage_type, Kind == iter_kind::constant, view_member_stats_s);
+        }
+
+    public:
+        using container_type = std::conditional_t<Kind == iter_kind::constant, const vector, vector>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        /* Supports `into_tuple`, `steal_from` and comparisons (but not `into<T>` as it covers only some members) */
+        struct reference : reference_storage_type,
+                           mrf::mixin::make_mixin<reference>,
+                           mrf::mixin::into_tuple_mixin,
+                           mrf::mixin::from_mixin<void>,
+                           mrf::mixin::cmp_mixin {
+            using original_type = T;
+            using vector_type = vector;
+            using storage_type = reference_storage_type;
+        };
+        using value_type = reference;
+
+        class iterator {
+        public:
+            using reference = bucket_view::reference;
+            using value_type = reference;
+            using difference_type = std::ptrdiff_t;
+
+            constexpr iterator() = default;
+            constexpr iterator(container_type* container, std::size_t idx)
+                : container(container)
+                , idx(idx) {}
+
+            constexpr reference operator*() const noexcept {
+                return bucket_view::reference_at(*container, idx);
+            }
+
+            constexpr iterator& operator++() noexcept {
+                ++idx;
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept {
+                const auto copy = *this;
+                ++idx;
+                return copy;
+            }
+
+            constexpr iterator& operator--() noexcept {
+                --idx;
+                return *this;
+            }
+
+            constexpr iterator operator--(int) noexcept {
+                const auto copy = *this;
+                --idx;
+                return copy;
+            }
+
+            constexpr iterator& operator-=(difference_type offset) noexcept {
+                idx -= offset;
+                return *this;
+            }
+
+            constexpr iterator& operator+=(difference_type offset) noexcept {
+                idx += offset;
+                return *this;
+            }
+
+            constexpr reference operator[](difference_type offset) const {
+                return bucket_view::reference_at(*container, idx + offset);
+            }
+
+        private:
+            constexpr friend auto operator<=>(const iterator& l, const iterator& r) noexcept {
+                return l.idx <=> r.idx;
+            }
+
+            constexpr friend bool operator==(const iterator& l, const iterator& r) noexcept {
+                return l.idx == r.idx;
+            }
+
+            constexpr friend iterator operator+(iterator that, difference_type offset) noexcept {
+                that.idx += offset;
+                return that;
+            }
+
+            constexpr friend iterator operator+(difference_type offset, iterator that) noexcept {
+                that.idx += offset;
+                return that;
+            }
+
+            constexpr friend iterator operator-(iterator that, difference_type offset) noexcept {
+                that.idx -= offset;
+                return that;
+            }
+
+            constexpr friend difference_type operator-(const iterator& l, const iterator& r) noexcept {
+                return difference_type(l.idx) - difference_type(r.idx);
+            }
+
+        private:
+            container_type* container = {};
+            std::size_t idx = 0;
+        };
+
+        constexpr bucket_view() = default;
+        constexpr explicit bucket_view(container_type& container)
+            : container(&container) {}
+
+        constexpr iterator begin() const {
+            return iterator{ container, 0 };
+        }
+
+        constexpr iterator end() const {
+            return iterator{ container, size() };
+        }
+
+        constexpr size_type size() const {
+            return container->size();
+        }
+
+        [[nodiscard]] constexpr bool empty() const {
+            return container->empty();
+        }
+
+        constexpr reference operator[](size_type idx) const {
+            return reference_at(*container, idx);
+        }
+
+        /* Underlying `mrf::vector` (used by the projections) */
+        constexpr container_type& base() const {
+            return *container;
+        }
+
+        static consteval bool contains(std::meta::info item_member) {
+            return std::ranges::contains(view_member_stats_s.data.begin(),
+                view_member_stats_s.data.begin() + view_member_stats_s.size, item_member, &member_stat::item_member);
+        }
+
+    private:
+        static constexpr reference reference_at(container_type& container, size_type idx) {
+            return misc::static_vector_spread<view_member_stats_s>([&]<member_stat... Stats> {
+                return reference{ vector::member_at<Stats>(container.storage, idx)... };
+            });
+        }
+
+        container_type* container = {};
+    };
+
+public:
+    using original_type = T;
+    using value_type = reference;
+    using allocator_type = Alloc;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = ref_iterator<iter_kind::regular>;
+    using const_iterator = ref_iterator<iter_kind::constant>;
+
+    constexpr vector() = default;
+
+    constexpr explicit vector(const Alloc& alloc)
+        : storage(make_storage(alloc))
+        , allocator(alloc) {}
+
+    /**
+     * Every bucket allocates through `alloc` except the ones overridden with `mrf::bucket_allocator<Id>(...)`.
+     *
+     * mrf::pmr::vector<Person> persons(&general_heap, mrf::bucket_resource<mrf::hot>(&hot_pool));
+     */
+    template <auto... Ids, typename... TAllocs>
+    constexpr explicit vector(const Alloc& alloc, const bucket_allocator_t<Ids, TAllocs>&... bucket_allocs)
+        : storage(make_storage(alloc, bucket_allocs...))
+        , allocator(alloc) {
+        static_assert(are_bucket_overrides_valid<Ids...>(),
+            R"(`mrf::bucket_allocator<Id>`: every `Id` should name a bucket of `T` and no bucket may be overridden twice)");
+        static_assert(!contiguous_s,
+            R"(`mrf::bucket_allocator<Id>` can't be combined with `mrf::contiguous`: all buckets share the blocks of `Alloc`)");
+    }
+
+    /* Range of `T` or of `mrf::vector<T>` references */
+    template <typename R>
+        requires std::ranges::input_range<R> && is_row_v<std::ranges::range_reference_t<R>>
+    constexpr vector(std::from_range_t, R&& rg, const Alloc& alloc = Alloc())
+        : vector(alloc) {
+        append_range(std::forward<R>(rg));
+    }
+
+    /* The allocator given to the constructor (not the `mrf::bucket_allocator` overrides) */
+    constexpr allocator_type get_allocator() const {
+        return allocator.alloc;
+    }
+
+    /**
+     * View over all rows which iterates through the cached base pointers of the buckets and ends with a sentinel,
+     * so simple loops over it (e.g. a sum over `mrf::proj::member<^^T::x>`) get auto-vectorized.
+     * Like raw pointers the view is invalidated by any reallocation (`push_back`, `reserve`, ...).
+     */
+    template <typename TSelf>
+    constexpr auto fast_view(this TSelf& self) {
+        constexpr auto kind = std::is_const_v<TSelf> ? iter_kind::constant : iter_kind::regular;
+
+        return misc::spread<misc::nsdm_of<^^storage_type>()>([&]<std::meta::info... StorageMembers> {
+            return fast_view_type<kind>{ { self.storage.[:StorageMembers:].data()... }, self.size() };
+        });
+    }
+
+    /**
+     * View over rows restricted to the members of `Ids...` buckets:
+     *
+     * for (auto person : persons.view<mrf::hot, ^^Person::age>()) { ... } // never touches other (cold) buckets
+     *
+     * Works with the projections and sorting algorithms. Sorting a view compares the keys read through the view but
+     * moves whole rows of the underlying vector (every bucket).
+     */
+    template <auto... Ids, typename TSelf>
+        requires(sizeof...(Ids) > 0 && (cpt::bucket_id<Ids> && ...))
+    constexpr auto view(this TSelf& self) {
+        constexpr auto kind = std::is_const_v<TSelf> ? iter_kind::constant : iter_kind::regular;
+        return bucket_view<kind, Ids...>{ self };
+    }
+
+    /**
+     * Call `fn` for every block of `K` rows (the last one may be shorter) with a `std::span` into every bucket (in the
+     * order of buckets) or only into the buckets `Ids...` (in the given order), so kernels work on tight contiguous
+     * arrays instead of row references:
+     *
+     * particles.for_each_chunk<256, mrf::hot>([](std::span<mrf::bucket<Particle, mrf::hot>> hot) { ... });
+     *
+     * AoSoA buckets are given as spans of the tiles covering the block (`K` should be a multiple of the tile size).
+     */
+    template <std::size_t K, auto... Ids, typename TSelf, typename TFn>
+        requires(K > 0 && (cpt::bucket_id<Ids> && ...))
+    constexpr void for_each_chunk(this TSelf& self, TFn&& fn) {
+        self.template for_each_chunk<K, Ids...>(0, self.size(), std::forward<TFn>(fn));
+    }
+
+    /**
+     * Same as `for_each_chunk(fn)` but only for the rows [first, last) - disjoint row ranges can be processed by
+     * different threads (`first` should be a multiple of the AoSoA tile sizes).
+     */
+    template <std::size_t K, auto... Ids, typename TSelf, typename TFn>
+        requires(K > 0 && (cpt::bucket_id<Ids> && ...))
+    constexpr void for_each_chunk(this TSelf& self, size_type first_row, size_type last_row, TFn&& fn) {
+        const auto chunk_of = [](auto& bucket, size_type first, size_type count) {
+            using storage_member_type = std::remove_cvref_t<decltype(bucket)>;
+
+            if constexpr (misc::is_tiled_vector_v<storage_member_type>) {
+                constexpr size_type tile_size = storage_member_type::tile_size;
+                static_assert(K % tile_size == 0, "chunk size should be a multiple of the AoSoA tile size");
+                assert(first % tile_size == 0);
+
+                return std::span(bucket.data() + first / tile_size, (count + tile_size - 1) / tile_size);
+            } else {
+                return std::span(bucket.data() + first, count);
+            }
+        };
+
+        assert(first_row <= last_row && last_row <= self.size());
+
+        for (size_type first = first_row; first < last_row; first += K) {
+            const size_type count = std::min(K, last_row - first);
+
+            if constexpr (sizeof...(Ids) == 0) {
+                misc::spread<misc::nsdm_of<^^storage_type>()>([&]<std::meta::info... StorageMembers> {
+                    std::invoke(fn, chunk_of(self.storage.[:StorageMembers:], first, count)...);
+                });
+            } else {
+                std::invoke(fn, chunk_of(self.template bucket<Ids>(), first, count)...);
+            }
+        }
+    }
+
+    /* Compact (container + index) proxy reference to the row `idx` (see `mrf::lazy_reference`) */
+    template <typename TSelf>
+    constexpr auto lazy(this TSelf& self, size_type idx) {
+        return mrf::lazy_reference<TSelf>{ self, idx };
+    }
+
+    /* All rows as `mrf::lazy_reference`s */
+    template <typename TSelf>
+    constexpr auto lazy_view(this TSelf& self) {
+        return std::views::iota(size_type{ 0 }, self.size()) |
+            std::views::transform([&self](size_type idx) { return mrf::lazy_reference<TSelf>{ self, idx }; });
+    }
+
+    template <auto Id>
+        requires cpt::bucket_id<Id>
+    constexpr const auto& bucket() const {
+        return bucket_impl<Id>();
+    }
+
+    /**
+     * Be careful with changing the size of a mutable bucket!
+     * Using mrf::vector while buckets have different size is UB!
+     */
+    template <auto Id>
+        requires cpt::bucket_id<Id>
+    constexpr auto& bucket() {
+        return bucket_impl<Id>();
+    }
+
+    constexpr auto begin() {
+        return iterator{ this, 0 };
+    }
+
+    constexpr auto end() {
+        return iterator{ this, size() };
+    }
+
+    constexpr auto begin() const {
+        return const_iterator{ this, 0 };
+    }
+
+    constexpr auto end() const {
+        return const_iterator{ this, size() };
+    }
+
+    constexpr auto cbegin() {
+        return const_iterator{ this, 0 };
+    }
+
+    constexpr auto cend() {
+        return const_iterator{ this, size() };
+    }
+
+    constexpr auto cbegin() const {
+        return const_iterator{ this, 0 };
+    }
+
+    constexpr auto cend() const {
+        return const_iterator{ this, size() };
+    }
+
+    constexpr void push_back(const T& item) {
+        push_back_impl(item);
+    }
+
+    constexpr void push_back(T&& item) {
+        push_back_impl(std::move(item));
+    }
+
+    constexpr void push_back(const reference& ref) {
+        push_back_ref_impl(ref);
+    }
+
+    constexpr void push_back(const const_reference& ref) {
+        push_back_ref_impl(ref);
+    }
+
+    /* Reference into a `mrf::vector<T>` with a different allocator (e.g. the one produced by `mrf::from`) */
+    template <typename TRef>
+        requires std::same_as<typename TRef::value_type, T> && std::same_as<typename TRef::original_type, T>
+    constexpr void push_back(const TRef& ref) {
+        push_back_ref_impl(ref);
+    }
+
+    /**
+     * Append a row given as a tuple of its members (in the declaration order of `T`). Every member is constructed
+     * straight into its bucket, no temporary `T` is built.
+     *
+     * persons.push_back(std::tuple{ 1, 19, "Alice", "Bay" });
+     */
+    template <typename TTuple>
+        requires(!is_row_v<TTuple>) && mrf::tuple_like_relaxed<TTuple, members_count>
+    constexpr void push_back(TTuple&& members) {
+        emplace_back_members_impl(std::forward<TTuple>(members));
+    }
+
+    /**
+     * Append all rows of `rg` (range of `T`, of `mrf::vector<T>` references or `mrf::vector<T>` itself).
+     * The capacity is checked once and then every bucket is filled in its own pass over `rg` (column-wise) so each
+     * bucket array is written linearly. Appending another `mrf::vector<T>` copies bucket arrays as a whole (which
+     * boils down to `memcpy` for trivially copyable buckets). A range of references into this very vector
+     * (`std::views::all(*this)`, `*this | std::views::take(n)`, ...) is copied out first.
+     */
+    template <typename R>
+        requires std::ranges::input_range<R> && is_row_v<std::ranges::range_reference_t<R>>
+    constexpr void append_range(R&& rg) {
+        if constexpr (std::same_as<std::remove_cvref_t<R>, vector>) {
+            if (&rg == this) {
+                const vector copy = rg;
+                append_buckets(copy);
+            } else {
+                append_buckets(rg);
+            }
+        } else if constexpr (may_alias_v<R>) {
+            /* Every bucket pass over a view of this very vector would see the rows appended by the previous passes */
+            vector rows(get_allocator());
+            rows.append_rows(std::forward<R>(rg));
+            append_buckets(rows);
+        } else {
+            append_rows(std::forward<R>(rg));
+        }
+    }
+
+    template <typename R>
+        requires std::ranges::input_range<R> && is_row_v<std::ranges::range_reference_t<R>>
+    constexpr void assign_range(R&& rg) {
+        if constexpr (std::same_as<std::remove_cvref_t<R>, vector>) {
+            if (&rg == this) {
+                return;
+            }
+        } else if constexpr (may_alias_v<R>) {
+            /* `rg` may view this very vector - take its rows out before clearing */
+            vector rows(get_allocator());
+            rows.append_rows(std::forward<R>(rg));
+            clear();
+            append_buckets(rows);
+            return;
+        }
+
+        clear();
+        append_range(std::forward<R>(rg));
+    }
+
+    /* Insert `item` before `pos`, every bucket shifts its tail on its own */
+    constexpr iterator insert(const_iterator pos, const T& item) {
+        return insert_impl(pos, item);
+    }
+
+    constexpr iterator insert(const_iterator pos, T&& item) {
+        return insert_impl(pos, std::move(item));
+    }
+
+    constexpr iterator insert(const_iterator pos, const reference& ref) {
+        return insert_impl(pos, ref);
+    }
+
+    constexpr iterator insert(const_iterator pos, const const_reference& ref) {
+        return insert_impl(pos, ref);
+    }
+
+    constexpr iterator erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+
+    /* Remove rows [first, last), every bucket shifts its tail down on its own */
+    constexpr iterator erase(const_iterator first, const_iterator last) {
+        const auto first_idx = size_type(first - cbegin());
+        const auto last_idx = size_type(last - cbegin());
+
+        if (first_idx != last_idx) {
+            misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+                auto& bucket = storage.[:StorageMemberStat.storage_member:];
+
+                if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                    bucket.erase(first_idx, last_idx);
+                } else {
+                    bucket.erase(bucket.begin() + first_idx, bucket.begin() + last_idx);
+                }
+            });
+        }
+
+        return iterator{ this, first_idx };
+    }
+
+    /**
+     * Remove all rows satisfying `pred` (invoked with `const_reference`). Returns the number of removed rows.
+     * The rows to remove are found first and then every bucket is compacted in its own pass: the runs of surviving
+     * rows are moved down as a whole (which boils down to `memmove` for trivially copyable buckets).
+     */
+    template <typename TPred>
+    constexpr size_type erase_if(TPred pred) {
+        const auto erased = find_rows(pred);
+
+        if (!erased.empty()) {
+            compact(erased);
+        }
+        return erased.size();
+    }
+
+    /**
+     * Erase the rows `rows` (strictly ascending, e.g. a selection vector of `mrf::select`) preserving the order of
+     * the rest; every bucket is compacted in a single pass (see `erase_if`). Returns the number of erased rows.
+     */
+    constexpr size_type erase_rows(std::span<const size_type> rows) {
+        assert(std::ranges::adjacent_find(rows, std::ranges::greater_equal{}) == rows.end());
+        assert(rows.empty() || rows.back() < size());
+
+        if (!rows.empty()) {
+            compact(rows);
+        }
+        return rows.size();
+    }
+
+    /**
+     * Copy of the rows `rows` (e.g. a selection vector of `mrf::select`) in the given order, gathered bucket by
+     * bucket.
+     */
+    constexpr vector gather(std::span<const size_type> rows) const {
+        vector gathered(get_allocator());
+        gathered.reserve(rows.size());
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            const auto& from = storage.[:StorageMemberStat.storage_member:];
+            auto& to = gathered.storage.[:StorageMemberStat.storage_member:];
+
+            for (const size_type idx : rows) {
+                if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(from)>>) {
+                    to.push_back(from.get(idx));
+                } else {
+                    to.push_back(from[idx]);
+                }
+            }
+        });
+        return gathered;
+    }
+
+    /**
+     * Write the rows [first_row, first_row + out.size()) into the (constructed) `T`s of `out`. This is a block-wise
+     * column-to-row transpose: member after member for a block of rows small enough to keep the destination rows
+     * cache resident, so every source column is read sequentially. Called on an rvalue the members are moved out.
+     *
+     * std::vector<Person> aos(persons.size());
+     * persons.copy_into(aos);
+     */
+    template <typename TSelf>
+    constexpr void copy_into(this TSelf&& self, std::span<T> out, size_type first_row = 0) {
+        constexpr bool move = !std::is_lvalue_reference_v<TSelf>;
+        constexpr size_type block_rows = std::max<size_type>(copy_block_bytes_s / sizeof(T), 1);
+
+        assert(first_row + out.size() <= self.size());
+
+        for (size_type first = 0; first < out.size(); first += block_rows) {
+            const size_type last = std::min(first + block_rows, out.size());
+
+            misc::spread<member_stats_s>([&]<member_stat... Stats> {
+                (transpose_member<Stats, move>(self.storage, out, first_row, first, last), ...);
+            });
+        }
+    }
+
+    /**
+     * Append the rows [first_row, last_row) to `out` without value-initializing them there first: every block of
+     * rows is transposed (see `copy_into`) into a small cache-resident buffer of `T`s and then moved to the end of
+     * `out`. Called on an rvalue the members are moved out.
+     *
+     * std::vector<Person> aos;
+     * persons.append_into(aos);
+     */
+    template <typename TSelf, typename TOutAlloc>
+    constexpr void append_into(this TSelf&& self, std::vector<T, TOutAlloc>& out, size_type first_row, size_type last_row) {
+        constexpr size_type block_rows = std::max<size_type>(copy_block_bytes_s / sizeof(T), 1);
+
+        assert(first_row <= last_row && last_row <= self.size());
+        out.reserve(out.size() + (last_row - first_row));
+
+        std::vector<T> buffer(std::min(block_rows, last_row - first_row));
+        for (size_type first = first_row; first < last_row; first += block_rows) {
+            const auto block = std::span(buffer).first(std::min(block_rows, last_row - first));
+
+            std::forward<TSelf>(self).copy_into(block, first);
+            out.insert(out.end(), std::make_move_iterator(block.begin()), std::make_move_iterator(block.end()));
+        }
+    }
+
+    template <typename TSelf, typename TOutAlloc>
+    constexpr void append_into(this TSelf&& self, std::vector<T, TOutAlloc>& out) {
+        std::forward<TSelf>(self).append_into(out, 0, self.size());
+    }
+
+    /**
+     * O(1) erase which doesn't preserve the order of rows: the last row is moved into the hole and then popped.
+     * Every bucket is touched exactly once.
+     */
+    constexpr void erase_unordered(size_type idx) {
+        const size_type last_idx = size() - 1;
+
+        if (idx == last_idx) {
+            relocate_rows({}, last_idx);
+        } else {
+            const std::pair<size_type, size_type> move{ idx, last_idx };
+            relocate_rows(std::span(&move, 1), last_idx);
+        }
+    }
+
+    /**
+     * Remove all rows satisfying `pred` (invoked with `const_reference`) without preserving the order of rows.
+     * Returns the number of removed rows. The holes are filled with the surviving rows from the tail (the last
+     * survivor goes into the first hole) and then every bucket is truncated, one bucket at a time.
+     */
+    template <typename TPred>
+    constexpr size_type erase_unordered_if(TPred pred) {
+        const auto erased = find_rows(pred);
+        if (erased.empty()) {
+            return 0;
+        }
+
+        const size_type new_size = size() - erased.size();
+        std::vector<std::pair<size_type, size_type>> moves;
+
+        auto erased_it = erased.rbegin();
+        auto hole_it = erased.begin();
+        for (size_type src = size(); src-- > new_size && hole_it != erased.end() && *hole_it < new_size;) {
+            if (erased_it != erased.rend() && *erased_it == src) {
+                ++erased_it;
+            } else {
+                moves.emplace_back(*hole_it++, src);
+            }
+        }
+
+        relocate_rows(moves, new_size);
+        return erased.size();
+    }
+
+    /**
+     * Append `T{ args... }`. When `T` is an aggregate and `args` are member-wise (one argument per member, each
+     * convertible to it) every member is constructed straight into its bucket slot, without a temporary `T`.
+     */
+    template <typename... Args>
+    constexpr reference emplace_back(Args&&... args) {
+        if constexpr (is_member_wise_v<Args...>) {
+            emplace_back_members_impl(std::forward_as_tuple(std::forward<Args>(args)...));
+        } else {
+            push_back_impl(T{ std::forward<Args>(args)... });
+        }
+        return back();
+    }
+
+    constexpr reference back() {
+        return *(--end());
+    }
+
+    constexpr const_reference back() const {
+        return *(--end());
+    }
+
+    constexpr reference front() {
+        return *begin();
+    }
+
+    constexpr const_reference front() const {
+        return *begin();
+    }
+
+    constexpr reference operator[](size_type idx) {
+        return *(begin() + idx);
+    }
+
+    constexpr const_reference operator[](size_type idx) const {
+        return *(begin() + idx);
+    }
+
+    constexpr reference at(size_type idx) {
         if (idx >= size()) {
             throw std::out_of_range("out of range");
         }
-        return *(begin() + idx);
+        return *(begin() + idx);
+    }
+
+    constexpr const_reference at(size_type idx) const {
+        if (idx >= size()) {
+            throw std::out_of_range("out of range");
+        }
+        return *(begin() + idx);
+    }
+
+    [[nodiscard]] constexpr bool empty() const {
+        return storage.[:misc::nsdm_of(^^storage_type)[0]:].empty();
+    }
+
+    constexpr size_type size() const {
+        return storage.[:misc::nsdm_of(^^storage_type)[0]:].size();
+    }
+
+    /**
+     * Rows which fit into every bucket without reallocation. Buckets grow in lockstep (see `reserve`) so their
+     * capacities only differ after a bucket was reallocated on its own (copy, `permute`, ...).
+     */
+    constexpr size_type capacity() const {
+        size_type cap = std::numeric_limits<size_type>::max();
+        misc::static_vector_foreach<storage_stats_s>([&cap, this]<storage_member_stat StorageMemberStat> {
+            cap = std::min(cap, storage.[:StorageMemberStat.storage_member:].capacity());
+        });
+        return cap;
+    }
+
+    /**
+     * Grow every bucket in a single step. This is the only place where buckets reallocate.
+     * The new capacity is padded up to a multiple of `capacity_granularity_s` (matters for `mrf::align<N>` buckets).
+     */
+    constexpr void reserve(size_type new_cap) {
+        if (new_cap <= capacity()) {
+            return;
+        }
+        new_cap = padded_capacity(new_cap);
+
+        reallocate_buckets(new_cap, [new_cap](auto& bucket) { bucket.reserve(new_cap); });
+    }
+
+    constexpr void shrink_to_fit() {
+        if constexpr (capacity_granularity_s == 1 && !contiguous_s) {
+            misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> {
+                storage.[:StorageMemberStat.storage_member:].shrink_to_fit();
+            });
+        } else {
+            /* `std::vector::shrink_to_fit` would drop the padding - reallocate to the padded size manually. */
+            const size_type new_cap = padded_capacity(size());
+            if (new_cap >= capacity()) {
+                return;
+            }
+
+            reallocate_buckets(new_cap, [new_cap](auto& bucket) {
+                if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                    bucket.shrink_to(new_cap);
+                } else {
+                    std::remove_cvref_t<decltype(bucket)> shrunk(bucket.get_allocator());
+                    shrunk.reserve(new_cap);
+                    std::ranges::move(bucket, std::back_inserter(shrunk));
+                    bucket.swap(shrunk);
+                }
+            });
+        }
+    }
+
+    constexpr void clear() {
+        misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> { //
+            storage.[:StorageMemberStat.storage_member:].clear();
+        });
+    }
+
+    constexpr void pop_back() {
+        misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> { //
+            storage.[:StorageMemberStat.storage_member:].pop_back();
+        });
+    }
+
+    constexpr void resize(size_type new_size)
+        requires std::is_default_constructible_v<T>
+    {
+        resize(new_size, T{});
+    }
+
+    constexpr void resize(size_type new_size, const T& default_val) {
+        reserve_for_append(new_size > size() ? new_size - size() : 0);
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
+                storage.[:StorageMemberStat.storage_member:].resize(new_size, { default_val.[:BucketMemberStats.item_member:]... });
+            });
+        });
+    }
+
+    /**
+     * Same as `resize` but meant for bulk loads which overwrite every member of the new rows anyway
+     * (deserialization, ...). The new rows of trivially default constructible buckets are left uninitialized
+     * (AoSoA buckets are still value-initialized), which is done by `mrf::default_init_allocator` - hence the call
+     * is ill-formed with any other allocator rather than silently value-initializing like `resize`.
+     *
+     * mrf::vector<Row, mrf::default_init_allocator<std::allocator<Row>>> rows;
+     */
+    constexpr void resize_for_overwrite(size_type new_size)
+        requires is_specialization_of_v<misc::default_init_allocator, Alloc>
+    {
+        reserve_for_append(new_size > size() ? new_size - size() : 0);
+
+        misc::static_vector_foreach<storage_stats_s>([new_size, this]<storage_member_stat StorageMemberStat> {
+            storage.[:StorageMemberStat.storage_member:].resize(new_size);
+        });
+    }
+
+    /**
+     * Reorder rows so that the row `idx` becomes the former row `order[idx]` (`order` is a permutation of
+     * [0, size())). Every bucket is gathered into a new array in a single linear pass, one bucket at a time.
+     */
+    constexpr void permute(std::span<const size_type> order) {
+        assert(order.size() == size());
+        assert(is_permutation_order(order));
+
+        misc::static_vector_foreach<storage_stats_s>([order, this]<storage_member_stat StorageMemberStat> {
+            permute_bucket<StorageMemberStat.storage_member>(order);
+        });
+    }
+
+    /**
+     * Same as `permute(order)` but every bucket of trivially default constructible elements is gathered by all the
+     * threads of `pool`, each task filling its own range of rows of the new bucket array. That array is sized up
+     * front, which costs a `memset` (nothing with `mrf::default_init_allocator`) for such buckets only. Every other
+     * bucket is gathered by the calling thread, move-constructing its rows straight into place.
+     */
+    void permute(std::span<const size_type> order, misc::thread_pool& pool) {
+        assert(order.size() == size());
+        assert(is_permutation_order(order));
+
+        const size_type chunk_count = (size() + misc::parallel_chunk_rows - 1) / misc::parallel_chunk_rows;
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            auto& bucket = storage.[:StorageMemberStat.storage_member:];
+            using storage_member_type = std::remove_cvref_t<decltype(bucket)>;
+
+            if constexpr (std::is_trivially_default_constructible_v<bucket_element_t<storage_member_type>>) {
+                storage_member_type permuted(bucket.get_allocator());
+                permuted.reserve(bucket.capacity());
+                permuted.resize(size());
+
+                pool.for_each_index(chunk_count, [&](size_type chunk) {
+                    const size_type first = chunk * misc::parallel_chunk_rows;
+                    const size_type last = std::min(first + misc::parallel_chunk_rows, size());
+
+                    for (size_type idx = first; idx < last; ++idx) {
+                        if constexpr (misc::is_tiled_vector_v<storage_member_type>) {
+                            permuted.assign(idx, bucket.take(order[idx]));
+                        } else {
+                            permuted[idx] = std::move(bucket[order[idx]]);
+                        }
+                    }
+                });
+                bucket.swap(permuted);
+            } else {
+                permute_bucket<StorageMemberStat.storage_member>(order);
+            }
+        });
+    }
+
+    constexpr void swap(vector& that) {
+        misc::static_vector_foreach<storage_stats_s>([&that, this]<storage_member_stat StorageMemberStat> {
+            storage.[:StorageMemberStat.storage_member:].swap(that.storage.[:StorageMemberStat.storage_member:]);
+        });
+
+        if constexpr (std::allocator_traits<Alloc>::propagate_on_container_swap::value) {
+            std::ranges::swap(allocator.alloc, that.allocator.alloc);
+        }
     }
 
-    constexpr const_reference at(size_type idx) const {
-        if (idx >= size()) {
-            throw std::out_of_range("out of range");
+private:
+    /* Every index of [0, order.size()) occurs in `order` exactly once (debug check of `permute`) */
+    static constexpr bool is_permutation_order(std::span<const size_type> order) {
+        std::vector<bool> seen(order.size());
+
+        for (const size_type idx : order) {
+            if (idx >= order.size() || seen[idx]) {
+                return false;
+            }
+            seen[idx] = true;
         }
-        return *(begin() + idx);
+
+        return true;
     }
 
-    [[nodiscard]] constexpr bool empty() const {
-        return storage.[:misc::nsdm_of(^^storage_type)[0]:].empty();
+    template <std::meta::info StorageMember>
+    constexpr void permute_bucket(std::span<const size_type> order) {
+        auto& bucket = storage.[:StorageMember:];
+        using storage_member_type = std::remove_cvref_t<decltype(bucket)>;
+
+        storage_member_type permuted(bucket.get_allocator());
+        permuted.reserve(bucket.capacity());
+
+        for (const size_type idx : order) {
+            if constexpr (misc::is_tiled_vector_v<storage_member_type>) {
+                permuted.push_back(bucket.take(idx));
+            } else {
+                permuted.push_back(std::move(bucket[idx]));
+            }
+        }
+
+        bucket.swap(permuted);
     }
 
-    constexpr size_type size() const {
-        return storage.[:misc::nsdm_of(^^storage_type)[0]:].size();
+    template <std::meta::info StorageMember>
+    static constexpr auto make_bucket_storage(const Alloc& alloc) {
+        using storage_member_type = typename[:type_of(StorageMember):];
+        using storage_allocator_type = typename storage_member_type::allocator_type;
+
+        return storage_member_type(storage_allocator_type(alloc));
     }
 
-    constexpr size_type capacity() const {
-        return storage.[:misc::nsdm_of(^^storage_type)[0]:].capacity();
+    template <std::meta::info StorageMember, auto Id, typename TAlloc, typename... TBucketAllocs>
+    static constexpr auto make_bucket_storage(
+        const Alloc& alloc, const bucket_allocator_t<Id, TAlloc>& bucket_alloc, const TBucketAllocs&... bucket_allocs) {
+        using storage_member_type = typename[:type_of(StorageMember):];
+        using storage_allocator_type = typename storage_member_type::allocator_type;
+
+        if constexpr (type_of(StorageMember) == dealias(^^bucket_storage<Id>)) {
+            return storage_member_type(storage_allocator_type(bucket_alloc.alloc));
+        } else {
+            return make_bucket_storage<StorageMember>(alloc, bucket_allocs...);
+        }
     }
 
-    constexpr void reserve(size_type new_cap) {
-        misc::static_vector_foreach<storage_stats_s>([new_cap, this]<storage_member_stat StorageMemberStat> {
-            storage.[:StorageMemberStat.storage_member:].reserve(new_cap);
+    /* `mrf::bucket_allocator<Ids>...` name existing and distinct buckets */
+    template <auto... Ids>
+    static consteval bool are_bucket_overrides_valid() {
+        const std::vector<std::meta::info> overridden{ dealias(^^bucket_storage<Ids>)... };
+        const auto storage_members = misc::nsdm_of(^^storage_type);
+
+        return std::ranges::all_of(overridden, [&](std::meta::info storage_member_type) {
+            return std::ranges::contains(storage_members, storage_member_type, &std::meta::type_of) &&
+                std::ranges::count(overridden, storage_member_type) == 1;
         });
     }
 
-    constexpr void shrink_to_fit() {
-        misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> {
-            storage.[:StorageMemberStat.storage_member:].shrink_to_fit();
+    template <typename... TBucketAllocs>
+    static constexpr storage_type make_storage(const Alloc& alloc, const TBucketAllocs&... bucket_allocs) {
+        return misc::spread<misc::nsdm_of<^^storage_type>()>([&]<std::meta::info... StorageMembers> {
+            return storage_type{ make_bucket_storage<StorageMembers>(alloc, bucket_allocs...)... };
         });
     }
 
-    constexpr void clear() {
-        misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> { //
-            storage.[:StorageMemberStat.storage_member:].clear();
-        });
+    /* `out[idx].member = member of the row first_row + idx` for idx in [first, last) (see `copy_into`) */
+    template <member_stat Stat, bool Move, typename TStorage>
+    static constexpr void
+    transpose_member(TStorage& storage, std::span<T> out, size_type first_row, size_type first, size_type last) {
+        for (size_type idx = first; idx < last; ++idx) {
+            if constexpr (Move) {
+                out[idx].[:Stat.item_member:] = std::move(member_at<Stat>(storage, first_row + idx));
+            } else {
+                out[idx].[:Stat.item_member:] = member_at<Stat>(storage, first_row + idx);
+            }
+        }
     }
 
-    constexpr void pop_back() {
-        misc::static_vector_foreach<storage_stats_s>([this]<storage_member_stat StorageMemberStat> { //
-            storage.[:StorageMemberStat.storage_member:].pop_back();
-        });
+    /* Reference to the `Stat.item_member` of the row `idx` regardless of the bucket layout (regular or AoSoA) */
+    template <member_stat Stat, typename TStorage>
+    static constexpr auto& member_at(TStorage& storage, size_type idx) {
+        auto& bucket = storage.[:Stat.storage_member:];
+
+        if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+            return bucket.template lane<Stat.bucket_member>(idx);
+        } else {
+            return bucket[idx].[:Stat.bucket_member:];
+        }
     }
 
-    constexpr void resize(size_type new_size)
-        requires std::is_default_constructible_v<T>
-    {
-        resize(new_size, T{});
+    /* Same as `member_at` but through the cached bucket base pointers of `fast_view` */
+    template <member_stat Stat, typename TPointers>
+    static constexpr auto& pointer_member_at(const TPointers& pointers, size_type idx) {
+        using storage_member_type = typename[:type_of(Stat.storage_member):];
+
+        constexpr auto pointer_member = misc::nsdm_of(^^TPointers)[misc::index_of(misc::nsdm_of(^^storage_type), Stat.storage_member)];
+        auto* base = pointers.[:pointer_member:];
+
+        if constexpr (misc::is_tiled_vector_v<storage_member_type>) {
+            return storage_member_type::template lane_at<Stat.bucket_member>(base, idx);
+        } else {
+            return base[idx].[:Stat.bucket_member:];
+        }
     }
 
-    constexpr void resize(size_type new_size, const T& default_val) {
-        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
-            misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
-                storage.[:StorageMemberStat.storage_member:].resize(new_size, { default_val.[:BucketMemberStats.item_member:]... });
+    template <auto Id, typename TSelf>
+    constexpr auto bucket_reference_at(this TSelf& self, size_type idx) {
+        using bucket_reference_type = std::conditional_t<std::is_const_v<TSelf>, bucket_const_reference<Id>, bucket_reference<Id>>;
+        auto& bucket = self.template bucket_impl<Id>();
+
+        if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+            return misc::spread<misc::nsdm_of<^^bucket_storage_type<Id>>()>([&]<std::meta::info... Members> {
+                return bucket_reference_type{ bucket.template lane<Members>(idx)... };
             });
+        } else {
+            auto& [... members] = bucket[idx];
+            return bucket_reference_type{ members... };
+        }
+    }
+
+    static constexpr size_type padded_capacity(size_type cap) {
+        return (cap + capacity_granularity_s - 1) / capacity_granularity_s * capacity_granularity_s;
+    }
+
+    /**
+     * `fn(bucket)` reallocates every bucket to `new_cap` rows (allocating once per bucket). With `mrf::contiguous` the
+     * new arrays of all buckets are slices of a single block, one after another in the order of `storage_type`.
+     */
+    template <typename F>
+    constexpr void reallocate_buckets(size_type new_cap, F fn) {
+        if constexpr (contiguous_s) {
+            if !consteval {
+                misc::arena arena(allocator.alloc, contiguous_bytes(new_cap));
+
+                misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+                    arena.offer();
+                    fn(storage.[:StorageMemberStat.storage_member:]);
+                });
+                return;
+            }
+        }
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            fn(storage.[:StorageMemberStat.storage_member:]);
         });
     }
 
-    constexpr void swap(vector& that) {
-        misc::static_vector_foreach<storage_stats_s>([&that, this]<storage_member_stat StorageMemberStat> {
-            storage.[:StorageMemberStat.storage_member:].swap(that.storage.[:StorageMemberStat.storage_member:]);
+    /* Size of the block which holds `cap` rows of every bucket (see `reallocate_buckets`) */
+    static constexpr std::size_t contiguous_bytes(size_type cap) {
+        std::size_t bytes = 0;
+
+        misc::static_vector_foreach<storage_stats_s>([&]<storage_member_stat StorageMemberStat> {
+            using storage_member_type = typename[:type_of(StorageMemberStat.storage_member):];
+            using storage_allocator_type = typename storage_member_type::allocator_type;
+
+            if constexpr (misc::is_tiled_vector_v<storage_member_type>) {
+                using tile_allocator_type = typename std::allocator_traits<
+                    storage_allocator_type>::template rebind_alloc<typename storage_member_type::tile_type>;
+                constexpr size_type tile_size = storage_member_type::tile_size;
+
+                bytes += tile_allocator_type::slice_bytes((cap + tile_size - 1) / tile_size);
+            } else {
+                bytes += storage_allocator_type::slice_bytes(cap);
+            }
         });
+
+        return bytes;
+    }
+
+    /**
+     * Single capacity check for the whole row: when it fails all buckets are regrown together (geometrically) so
+     * the subsequent per-bucket `push_back`s never reallocate.
+     */
+    constexpr void reserve_for_append(size_type count) {
+        const size_type required = size() + count;
+
+        if (required > capacity()) {
+            reserve(std::max(required, capacity() * 2));
+        }
     }
 
-private:
     template <typename U>
     constexpr void push_back_impl(U&& item) {
+        reserve_for_append(1);
+
         misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
             misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
                 storage.[:StorageMemberStat.storage_member:].push_back(
@@ -652,8 +1907,218 @@ private:
         });
     }
 
+    template <typename TTuple>
+    constexpr void emplace_back_members_impl(TTuple&& members) {
+        constexpr auto nsdm = misc::nsdm_of<^^T>();
+
+        using std::get;
+        if (size() == capacity()) {
+            /* `members` may refer into this very vector - take them out before the buckets reallocate */
+            auto owned = misc::spread<nsdm>([&]<std::meta::info... Members> {
+                return std::tuple<typename[:type_of(Members):]...>{ get<misc::index_of(nsdm, Members)>(
+                    std::forward<TTuple>(members))... };
+            });
+            reserve_for_append(1);
+            emplace_back_members_impl(std::move(owned));
+            return;
+        }
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
+                auto& bucket = storage.[:StorageMemberStat.storage_member:];
+                using bucket_storage_type = std::remove_cvref_t<decltype(bucket)>;
+
+                if constexpr (misc::is_tiled_vector_v<bucket_storage_type>) {
+                    bucket.emplace_back(get<misc::index_of(nsdm, BucketMemberStats.item_member)>(std::forward<TTuple>(members))...);
+                } else {
+                    /* Returned prvalue initializes the slot directly (guaranteed copy elision) */
+                    bucket.emplace_back(misc::construct_with{ [&] {
+                        return bucket_element_t<bucket_storage_type>{
+                            { get<misc::index_of(nsdm, BucketMemberStats.item_member)>(std::forward<TTuple>(members))... } };
+                    } });
+                }
+            });
+        });
+    }
+
+    /* Member `ItemMember` (member of `T`) of either `T` itself (forwarded) or of `mrf::vector<T>` reference (copied) */
+    template <std::meta::info ItemMember, typename TItem>
+    static constexpr decltype(auto) forward_member(TItem&& item) {
+        if constexpr (std::same_as<std::remove_cvref_t<TItem>, T>) {
+            return std::forward_like<TItem>(item.[:ItemMember:]);
+        } else {
+            constexpr auto ref_nsdm = misc::nsdm_of(^^typename std::remove_cvref_t<TItem>::storage_type);
+            constexpr auto orig_nsdm = misc::nsdm_of(^^T);
+
+            return std::as_const(item.[:ref_nsdm[misc::index_of(orig_nsdm, ItemMember)]:]);
+        }
+    }
+
+    /* `append_range` of a range which doesn't alias this vector */
+    template <typename R>
+    constexpr void append_rows(R&& rg) {
+        if constexpr (std::ranges::forward_range<R>) {
+            reserve_for_append(size_type(std::ranges::distance(rg)));
+
+            misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+                misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
+                    auto& bucket = storage.[:StorageMemberStat.storage_member:];
+                    using bucket_value_type = typename std::remove_cvref_t<decltype(bucket)>::value_type;
+
+                    const auto into_bucket_value = []<typename TItem>(TItem&& item) {
+                        return bucket_value_type{ { forward_member<BucketMemberStats.item_member>(std::forward<TItem>(item))... } };
+                    };
+
+                    if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                        for (auto&& item : rg) {
+                            bucket.push_back(into_bucket_value(std::forward<decltype(item)>(item)));
+                        }
+                    } else {
+                        bucket.append_range(rg | std::views::transform(into_bucket_value));
+                    }
+                });
+            });
+        } else {
+            /* Single pass range - fallback to row by row */
+            for (auto&& item : rg) {
+                push_back(std::forward<decltype(item)>(item));
+            }
+        }
+    }
+
+    constexpr void append_buckets(const vector& that) {
+        reserve_for_append(that.size());
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            auto& bucket = storage.[:StorageMemberStat.storage_member:];
+            const auto& that_bucket = that.storage.[:StorageMemberStat.storage_member:];
+
+            if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                for (size_type idx = 0; idx < that_bucket.size(); ++idx) {
+                    bucket.push_back(that_bucket.get(idx));
+                }
+            } else {
+                bucket.append_range(that_bucket);
+            }
+        });
+    }
+
+    template <typename TItem>
+    constexpr iterator insert_impl(const_iterator pos, TItem&& item) {
+        const auto idx = size_type(pos - cbegin());
+
+        if constexpr (!std::same_as<std::remove_cvref_t<TItem>, T>) {
+            if (size() == capacity()) {
+                /* `item` may point into this very vector - copy the row out before the buckets reallocate */
+                vector row(get_allocator());
+                row.reserve(1);
+                row.push_back(item);
+                reserve_for_append(1);
+                return insert_impl(cbegin() + idx, std::as_const(row).front());
+            }
+        }
+
+        reserve_for_append(1);
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
+                auto& bucket = storage.[:StorageMemberStat.storage_member:];
+                using bucket_value_type = typename std::remove_cvref_t<decltype(bucket)>::value_type;
+
+                auto value = bucket_value_type{ { forward_member<BucketMemberStats.item_member>(std::forward<TItem>(item))... } };
+
+                if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                    bucket.insert(idx, std::move(value));
+                } else {
+                    bucket.insert(bucket.begin() + idx, std::move(value));
+                }
+            });
+        });
+
+        return iterator{ this, idx };
+    }
+
+    /* Ascending indices of the rows satisfying `pred` */
+    template <typename TPred>
+    constexpr std::vector<size_type> find_rows(TPred& pred) const {
+        std::vector<size_type> found;
+
+        for (size_type idx = 0; idx < size(); ++idx) {
+            if (std::invoke(pred, (*this)[idx])) {
+                found.push_back(idx);
+            }
+        }
+
+        return found;
+    }
+
+    /* Move rows `src` into `dst` for every (dst, src) pair of `moves` and drop the rows past `new_size` */
+    constexpr void relocate_rows(std::span<const std::pair<size_type, size_type>> moves, size_type new_size) {
+        const size_type old_size = size();
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            auto& bucket = storage.[:StorageMemberStat.storage_member:];
+
+            if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                for (const auto [dst, src] : moves) {
+                    bucket.move_element(dst, src);
+                }
+                bucket.erase(new_size, old_size);
+            } else {
+                for (const auto [dst, src] : moves) {
+                    bucket[dst] = std::move(bucket[src]);
+                }
+                bucket.erase(bucket.begin() + new_size, bucket.end());
+            }
+        });
+    }
+
+    /* Remove the rows at (ascending) `erased` indices moving the runs of surviving rows down, one bucket at a time */
+    constexpr void compact(std::span<const size_type> erased) {
+        const size_type old_size = size();
+        const size_type new_size = old_size - erased.size();
+
+        misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
+            auto& bucket = storage.[:StorageMemberStat.storage_member:];
+            size_type dst = erased.front();
+
+            for (size_type k = 0; k < erased.size(); ++k) {
+                const size_type run_first = erased[k] + 1;
+                const size_type run_last = k + 1 < erased.size() ? erased[k + 1] : old_size;
+
+                if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                    for (size_type src = run_first; src < run_last; ++src) {
+                        bucket.move_element(dst++, src);
+                    }
+                } else {
+                    std::ranges::move(bucket.begin() + run_first, bucket.begin() + run_last, bucket.begin() + dst);
+                    dst += run_last - run_first;
+                }
+            }
+
+            if constexpr (misc::is_tiled_vector_v<std::remove_cvref_t<decltype(bucket)>>) {
+                bucket.erase(new_size, old_size);
+            } else {
+                bucket.erase(bucket.begin() + new_size, bucket.end());
+            }
+        });
+    }
+
     template <typename TRef>
     constexpr void push_back_ref_impl(const TRef& ref) {
+        if constexpr (std::same_as<typename TRef::vector_type, vector>) {
+            if (size() == capacity()) {
+                /* `ref` may point into this very vector - copy the row out before the buckets reallocate */
+                vector row(get_allocator());
+                row.reserve(1);
+                row.push_back_ref_impl(ref);
+                append_buckets(row);
+                return;
+            }
+        }
+
+        reserve_for_append(1);
+
         misc::static_vector_foreach<storage_stats_s>([&, this]<storage_member_stat StorageMemberStat> {
             misc::static_vector_spread<StorageMemberStat.bucket_members>([&, this]<bucket_member_stat... BucketMemberStats> {
                 constexpr auto ref_nsdm = misc::nsdm_of(^^typename TRef::storage_type);
@@ -667,7 +2132,7 @@ private:
 
     template <auto Id, typename TSelf>
     constexpr auto& bucket_impl(this TSelf&& self) {
-        constexpr auto storage_member_type = ^^std::vector<bucket_type<Id>>;
+        constexpr auto storage_member_type = dealias(^^bucket_storage<Id>);
 
         constexpr auto storage_members = misc::nsdm_of(^^storage_type);
         constexpr auto found = std::ranges::find(storage_members, storage_member_type, &std::meta::type_of);
@@ -688,7 +2153,38 @@ private:
     }
 
 private:
+    /* `Alloc` given to the constructor, copied, assigned and swapped the way allocator-aware containers do */
+    struct allocator_holder {
+        using traits = std::allocator_traits<Alloc>;
+
+        constexpr allocator_holder() = default;
+        constexpr explicit allocator_holder(const Alloc& alloc)
+            : alloc(alloc) {}
+
+        constexpr allocator_holder(const allocator_holder& that)
+            : alloc(traits::select_on_container_copy_construction(that.alloc)) {}
+
+        constexpr allocator_holder(allocator_holder&&) = default;
+
+        constexpr allocator_holder& operator=(const allocator_holder& that) {
+            if constexpr (traits::propagate_on_container_copy_assignment::value) {
+                alloc = that.alloc;
+            }
+            return *this;
+        }
+
+        constexpr allocator_holder& operator=(allocator_holder&& that) {
+            if constexpr (traits::propagate_on_container_move_assignment::value) {
+                alloc = std::move(that.alloc);
+            }
+            return *this;
+        }
+
+        [[no_unique_address]] Alloc alloc{};
+    };
+
     storage_type storage;
+    [[no_unique_address]] allocator_holder allocator;
 };
 
 /**
@@ -708,6 +2204,39 @@ private:
 template <typename T, auto Id>
 using bucket = typename mrf::vector<T>::template bucket_type<Id>;
 
+/**
+ * Allocator for a single bucket of `mrf::vector<T, Alloc>` (overrides `Alloc` passed to the constructor).
+ *
+ * mrf::vector<Person, Arena> persons(general_arena, mrf::bucket_allocator<mrf::hot>(hot_arena));
+ */
+template <auto Id, typename TAlloc>
+    requires cpt::bucket_id<Id>
+constexpr auto bucket_allocator(TAlloc alloc) {
+    return bucket_allocator_t<Id, TAlloc>{ std::move(alloc) };
+}
+
+/**
+ * Memory resource for a single bucket of `mrf::pmr::vector<T>`.
+ * Hot buckets could come from a dedicated pool while the rest of the buckets use the general heap.
+ */
+template <auto Id>
+    requires cpt::bucket_id<Id>
+auto bucket_resource(std::pmr::memory_resource* resource) {
+    return bucket_allocator<Id>(std::pmr::polymorphic_allocator<std::byte>(resource));
+}
+
+/* Same as `std::erase_if` for `std::vector` */
+template <typename T, typename Alloc, typename TPred>
+constexpr auto erase_if(mrf::vector<T, Alloc>& container, TPred pred) {
+    return container.erase_if(std::move(pred));
+}
+
+/**
+ * Allocator adaptor which leaves trivially default constructible buckets uninitialized on `resize_for_overwrite`.
+ */
+template <typename TAlloc>
+using default_init_allocator = misc::default_init_allocator<TAlloc>;
+
 template <typename T, auto Id>
 using bucket_reference = typename mrf::vector<T>::template bucket_reference<Id>;
 
@@ -719,4 +2248,159 @@ using reference = typename mrf::vector<T>::reference;
 
 template <typename T>
 using const_reference = typename mrf::vector<T>::const_reference;
-} // namespace mrf
\ No newline at end of file
+
+/**
+ * Compact proxy reference into `mrf::vector<T>` (`TContainer` is `mrf::vector<T, Alloc>` or its const version).
+ * Unlike `mrf::vector<T>::reference` (one bound reference per member of `T`) it holds just the container and the
+ * index and resolves the address of a member only when it's accessed. Supports structured bindings:
+ *
+ * auto [id, age, name] = persons.lazy(0);
+ * persons.lazy(0).get<^^Person::age>() += 1;
+ *
+ * Like `mrf::vector<T>::reference` it is invalidated by any reallocation.
+ */
+template <typename TContainer>
+class lazy_reference {
+    using container_type = std::remove_const_t<TContainer>;
+    static constexpr auto members = misc::nsdm_of<^^typename container_type::original_type>();
+
+public:
+    using original_type = typename container_type::original_type;
+    using vector_type = container_type;
+    using size_type = std::size_t;
+    using reference = std::conditional_t<std::is_const_v<TContainer>,
+        typename container_type::const_reference,
+        typename container_type::reference>;
+
+    constexpr lazy_reference(TContainer& container, size_type idx)
+        : container(&container)
+        , idx(idx) {}
+
+    /* non-constant to constant reference implicit convertion */
+    constexpr lazy_reference(const lazy_reference<container_type>& that)
+        requires std::is_const_v<TContainer>
+        : container(that.container)
+        , idx(that.idx) {}
+
+    template <std::meta::info Member>
+    constexpr auto& get() const {
+        constexpr auto stat = *std::ranges::find(container_type::member_stats_s, Member, &container_type::member_stat::item_member);
+        return container_type::template member_at<stat>(container->storage, idx);
+    }
+
+    template <std::size_t I>
+    constexpr auto& get() const {
+        return get<members[I]>();
+    }
+
+    constexpr size_type index() const {
+        return idx;
+    }
+
+    /* Binds every member at once (e.g. to pass the row where `mrf::vector<T>::reference` is expected) */
+    constexpr operator reference() const {
+        return *(container->begin() + idx);
+    }
+
+    template <typename TInto = original_type>
+    constexpr TInto into() const {
+        return misc::spread<members>([this]<std::meta::info... Members> { return TInto{ get<Members>()... }; });
+    }
+
+    template <typename TInto = original_type>
+    constexpr TInto steal_into() const {
+        return misc::spread<members>([this]<std::meta::info... Members> { return TInto{ std::move(get<Members>())... }; });
+    }
+
+    constexpr auto into_tuple() const {
+        return misc::spread<members>([this]<std::meta::info... Members> { return std::make_tuple(get<Members>()...); });
+    }
+
+    constexpr auto steal_into_tuple() const {
+        return misc::spread<members>([this]<std::meta::info... Members> { //
+            return std::make_tuple(std::move(get<Members>())...);
+        });
+    }
+
+    template <typename UOriginal>
+        requires std::same_as<original_type, std::remove_cvref_t<UOriginal>>
+    constexpr void from(UOriginal&& other) const {
+        template for (constexpr auto member : members) {
+            get<member>() = std::forward_like<UOriginal>(other.[:member:]);
+        }
+    }
+
+    template <typename UContainer>
+    constexpr void from(const lazy_reference<UContainer>& other) const {
+        template for (constexpr auto member : members) {
+            get<member>() = other.template get<member>();
+        }
+    }
+
+    template <typename UOriginal>
+        requires std::same_as<original_type, std::remove_cvref_t<UOriginal>>
+    constexpr void steal_from(UOriginal& other) const {
+        from(std::move(other));
+    }
+
+    constexpr void steal_from(const lazy_reference& other) const {
+        template for (constexpr auto member : members) {
+            get<member>() = std::move(other.template get<member>());
+        }
+    }
+
+    template <typename TTuple>
+        requires mrf::tuple_like_relaxed<TTuple, members.size()>
+    constexpr void steal_from(TTuple&& tuple) const {
+        using std::get;
+        template for (constexpr auto I : misc::make_index_sequence<members.size()>()) {
+            this->get<I>() = std::move(get<I>(tuple));
+        }
+    }
+
+private:
+    template <typename UContainer>
+    friend class lazy_reference;
+
+    constexpr friend auto operator<=>(const lazy_reference& l, const lazy_reference& r) {
+        template for (constexpr auto member : members) {
+            if (auto res = l.get<member>() <=> r.get<member>(); res != 0) {
+                return res;
+            }
+        }
+
+        return std::strong_ordering::equal;
+    }
+
+    constexpr friend bool operator==(const lazy_reference& l, const lazy_reference& r) {
+        template for (constexpr auto member : members) {
+            if (!(l.get<member>() == r.get<member>())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    TContainer* container;
+    size_type idx;
+};
+
+template <std::size_t I, typename TContainer>
+constexpr auto& get(const lazy_reference<TContainer>& ref) {
+    return ref.template get<I>();
+}
+
+namespace pmr {
+template <typename T>
+using vector = mrf::vector<T, std::pmr::polymorphic_allocator<T>>;
+} // namespace pmr
+} // namespace mrf
+
+template <typename TContainer>
+struct std::tuple_size<mrf::lazy_reference<TContainer>>
+    : std::integral_constant<std::size_t, mrf::misc::nsdm_size_of(^^typename TContainer::original_type)> {};
+
+template <std::size_t I, typename TContainer>
+struct std::tuple_element<I, mrf::lazy_reference<TContainer>> {
+    using type = decltype(std::declval<const mrf::lazy_reference<TContainer>&>().template get<I>());
+};
\ No newline at end of file
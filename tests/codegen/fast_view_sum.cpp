@@ -0,0 +1,23 @@
+#include <morfo/morfo.hpp>
+
+/**
+ * Not a test by itself: CTest compiles this TU with `-Rpass=loop-vectorize` and expects the loop of `sum_mass` to
+ * get vectorized. It is the only loop written in this file, so any remark located in this file is about it (loops of
+ * the morfo headers are reported at their own locations) - don't add other loops here.
+ */
+namespace mrf::test::codegen {
+
+struct Particle {
+    float x{};
+    float y{};
+    int mass{};
+};
+
+int sum_mass(const mrf::vector<Particle>& particles) {
+    int sum = 0;
+    for (const auto& particle : particles.fast_view()) {
+        sum += mrf::proj::member<^^Particle::mass>(particle);
+    }
+    return sum;
+}
+} // namespace mrf::test::codegen
\ No newline at end of file
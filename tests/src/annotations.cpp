@@ -84,4 +84,326 @@ MRF_TEST_CASE_CTRT("user-defined bucket tag") {
 
     MRF_CHECK_EQ(rare_access_bucket[0].surname, "Lovelance");
 }
+
+MRF_TEST_CASE_CTRT("alignment annotation over-aligns the bucket and pads the capacity") {
+    struct Person {
+        [[= mrf::align<64>]] int age = 0;
+        std::string_view name;
+    };
+
+    static_assert(mrf::vector<Person>::bucket_alignment<^^Person::age> == 64);
+    static_assert(mrf::vector<Person>::bucket_alignment<^^Person::name> == alignof(std::string_view));
+
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 19, "Ann" });
+
+    /* 16 ints fill a single 64-byte block */
+    MRF_CHECK_EQ(persons.capacity(), 16);
+    MRF_CHECK_EQ(persons.bucket<^^Person::age>()[0].age, 19);
+    MRF_CHECK_EQ(persons.bucket<^^Person::name>()[0].name, "Ann");
+
+    persons.resize(17);
+    MRF_CHECK_EQ(persons.capacity(), 32);
+
+    persons.resize(3);
+    persons.shrink_to_fit();
+    MRF_CHECK_EQ(persons.capacity(), 16);
+    MRF_CHECK_EQ(persons.size(), 3);
+}
+
+MRF_TEST_CASE_RT("alignment annotation aligns the base address of the bucket array") {
+    struct[[= mrf::align<64>]] Person {
+        int age = 0;
+        [[= mrf::hot]] std::string_view name;
+    };
+
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 100; ++i) {
+        persons.push_back(Person{ i, "Ann" });
+    }
+
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(persons.bucket<^^Person::age>().data()) % 64, 0);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(persons.bucket<mrf::hot>().data()) % 64, 0);
+    CHECK_EQ(persons.bucket<^^Person::age>()[99].age, 99);
+}
+
+MRF_TEST_CASE_CTRT("contiguous annotation keeps the buckets usable as separate vectors") {
+    struct[[= mrf::contiguous]] Sample {
+        [[= mrf::align<64>]] float value = 0;
+        [[= mrf::hot]] int sensor = 0;
+        std::string_view label;
+    };
+
+    mrf::vector<Sample> samples;
+    for (int i = 0; i < 100; ++i) {
+        samples.push_back(Sample{ float(i), i % 4, "s" });
+    }
+
+    MRF_CHECK_EQ(samples.size(), 100);
+    MRF_CHECK_EQ(samples.bucket<^^Sample::value>().capacity(), samples.capacity());
+    MRF_CHECK_EQ(samples.bucket<mrf::hot>().capacity(), samples.capacity());
+    MRF_CHECK_EQ(samples.bucket<^^Sample::label>().capacity(), samples.capacity());
+    MRF_CHECK_EQ(samples[99].value, 99.0f);
+    MRF_CHECK_EQ(samples[99].sensor, 3);
+
+    samples.resize(10);
+    samples.shrink_to_fit();
+    MRF_CHECK_EQ(samples.capacity(), 16);
+    MRF_CHECK_EQ(samples.back().label, "s");
+
+    mrf::vector<Sample> copy = samples;
+    MRF_CHECK_EQ(copy[9].value, 9.0f);
+}
+
+MRF_TEST_CASE_RT("contiguous annotation carves all bucket arrays out of a single allocation") {
+    struct[[= mrf::contiguous]] Sample {
+        [[= mrf::align<64>]] float value = 0;
+        [[= mrf::hot]] int sensor = 0;
+        std::string_view label;
+    };
+
+    mrf::vector<Sample> samples;
+    samples.reserve(1000);
+
+    const auto& value_bucket = samples.bucket<^^Sample::value>();
+    const auto& sensor_bucket = samples.bucket<mrf::hot>();
+    const auto& label_bucket = samples.bucket<^^Sample::label>();
+    const auto value_first = reinterpret_cast<std::uintptr_t>(value_bucket.data());
+    const auto sensor_first = reinterpret_cast<std::uintptr_t>(sensor_bucket.data());
+    const auto label_first = reinterpret_cast<std::uintptr_t>(label_bucket.data());
+    const auto label_last = reinterpret_cast<std::uintptr_t>(label_bucket.data() + label_bucket.capacity());
+    const std::size_t row_bytes = sizeof(float) + sizeof(int) + sizeof(std::string_view);
+
+    /* Slices follow each other in the block, separated only by the back pointers and the alignment padding */
+    CHECK_EQ(value_first % 64, 0);
+    CHECK_LT(value_first, sensor_first);
+    CHECK_LT(sensor_first, label_first);
+    CHECK_LE(label_last - value_first, samples.capacity() * row_bytes + 3 * 128);
+
+    samples.push_back(Sample{ 1.0f, 2, "s" });
+    CHECK_EQ(samples.bucket<mrf::hot>()[0].sensor, 2);
+}
+
+MRF_TEST_CASE_CTRT("view iterates only the members of the selected buckets") {
+    struct Person {
+        [[= mrf::hot]] int id = 0;
+        [[= mrf::hot]] int score = 0;
+        int age = 0;
+        [[= mrf::cold]] std::string_view name;
+    };
+
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 10, 19, "Alice" });
+    persons.push_back(Person{ 2, 20, 25, "Bob" });
+
+    int score_sum = 0;
+    for (auto person : persons.view<mrf::hot>()) {
+        static_assert(misc::nsdm_size_of(^^typename decltype(person)::storage_type) == 2);
+        person.score += 1;
+        score_sum += person.score;
+    }
+    MRF_CHECK_EQ(score_sum, 32);
+
+    const auto& const_persons = persons;
+    const auto view = const_persons.view<mrf::hot, ^^Person::age>();
+
+    MRF_CHECK_EQ(view.size(), 2);
+    MRF_CHECK_EQ(view[1].age, 25);
+    MRF_CHECK_EQ(view[1].score, 21);
+    MRF_CHECK_EQ(mrf::proj::member<^^Person::age>(view[0]), 19);
+    MRF_CHECK_EQ(mrf::proj::bucket<mrf::hot>(view[0]).id, 1);
+    MRF_CHECK_EQ(std::get<2>(view[0].into_tuple()), 19);
+}
+
+MRF_TEST_CASE_CTRT("sorting a view moves whole rows of the underlying vector") {
+    struct Person {
+        [[= mrf::hot]] int id = 0;
+        [[= mrf::cold]] std::string_view name;
+    };
+
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 40; ++i) {
+        persons.push_back(Person{ 40 - i, "p" });
+    }
+    persons.back().name = "last";
+
+    auto hot = persons.view<mrf::hot>();
+    mrf::introsort(hot, std::less{}, mrf::proj::member<^^Person::id>);
+
+    for (int i = 0; i < 40; ++i) {
+        MRF_CHECK_EQ(persons[i].id, i + 1);
+    }
+    MRF_CHECK_EQ(persons.front().name, "last");
+
+    mrf::insertsort(hot, std::greater{}, mrf::proj::bucket<mrf::hot>);
+    MRF_CHECK_EQ(persons.front().id, 40);
+    MRF_CHECK_EQ(persons.back().name, "last");
+}
+
+MRF_TEST_CASE_CTRT("aosoa annotation stores the bucket in tiles of N rows") {
+    struct Particle {
+        [[= mrf::hot, = mrf::aosoa<4>]] float x = 0;
+        [[= mrf::hot]] float y = 0;
+        std::string_view name;
+    };
+
+    static_assert(mrf::vector<Particle>::bucket_tile_size<mrf::hot> == 4);
+    static_assert(mrf::vector<Particle>::bucket_tile_size<^^Particle::name> == 0);
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 6; ++i) {
+        particles.push_back(Particle{ float(i), float(i * 10), "p" });
+    }
+
+    const auto& hot_bucket = particles.bucket<mrf::hot>();
+
+    MRF_CHECK_EQ(hot_bucket.tile_count(), 2);
+    MRF_CHECK_EQ(hot_bucket.data()[1].x[1], 5.0f);
+    MRF_CHECK_EQ(hot_bucket.data()[1].y[0], 40.0f);
+    MRF_CHECK_EQ(particles[5].y, 50.0f);
+    MRF_CHECK_EQ(particles.capacity() % 4, 0);
+
+    particles.pop_back();
+    particles.pop_back();
+
+    MRF_CHECK_EQ(hot_bucket.tile_count(), 1);
+    MRF_CHECK_EQ(particles.size(), 4);
+    MRF_CHECK_EQ(particles.back().x, 3.0f);
+    MRF_CHECK_EQ(particles.back().name, "p");
+}
+
+MRF_TEST_CASE_CTRT("rows of aosoa bucket can be sorted") {
+    struct[[= mrf::aosoa<8>]] Particle {
+        int id = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 20; ++i) {
+        particles.push_back(Particle{ 20 - i, "p" });
+    }
+
+    mrf::insertsort(particles, std::less{}, mrf::proj::member<^^Particle::id>);
+
+    for (int i = 0; i < 20; ++i) {
+        MRF_CHECK_EQ(particles[i].id, i + 1);
+    }
+}
+
+MRF_TEST_CASE_CTRT("rows of aosoa bucket can be inserted and erased") {
+    struct Particle {
+        [[= mrf::aosoa<4>]] int id = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 10; ++i) {
+        particles.push_back(Particle{ i, "p" });
+    }
+
+    particles.insert(particles.cbegin() + 2, Particle{ 42, "q" });
+    MRF_CHECK_EQ(particles[2].id, 42);
+    MRF_CHECK_EQ(particles[3].id, 2);
+    MRF_CHECK_EQ(particles.bucket<^^Particle::id>().tile_count(), 3);
+
+    particles.erase(particles.cbegin() + 2);
+    particles.erase_if([](const auto& particle) { return particle.id % 2 == 1; });
+
+    MRF_CHECK_EQ(particles.size(), 5);
+    MRF_CHECK_EQ(particles.bucket<^^Particle::id>().tile_count(), 2);
+    for (int i = 0; i < 5; ++i) {
+        MRF_CHECK_EQ(particles[i].id, i * 2);
+    }
+}
+
+MRF_TEST_CASE_CTRT("fast_view reads lanes of aosoa bucket") {
+    struct Particle {
+        [[= mrf::aosoa<4>]] int id = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 10; ++i) {
+        particles.push_back(Particle{ i, "p" });
+    }
+
+    int id_sum = 0;
+    for (const auto& particle : particles.fast_view()) {
+        id_sum += particle.id;
+    }
+
+    MRF_CHECK_EQ(id_sum, 45);
+    MRF_CHECK_EQ(particles.fast_view()[9].id, 9);
+}
+
+MRF_TEST_CASE_CTRT("for_each_chunk passes aosoa bucket as spans of tiles") {
+    struct Particle {
+        [[= mrf::aosoa<4>]] int id = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 10; ++i) {
+        particles.push_back(Particle{ i, "p" });
+    }
+
+    int id_sum = 0;
+    std::size_t tile_count = 0;
+    particles.for_each_chunk<8>([&](auto tiles, auto names) {
+        tile_count += tiles.size();
+        for (std::size_t row = 0; row < names.size(); ++row) {
+            id_sum += tiles[row / 4].id[row % 4];
+        }
+    });
+
+    MRF_CHECK_EQ(tile_count, 3);
+    MRF_CHECK_EQ(id_sum, 45);
+}
+
+MRF_TEST_CASE_CTRT("copy_into reads lanes of aosoa bucket") {
+    struct Particle {
+        [[= mrf::hot, = mrf::aosoa<4>]] int id = 0;
+        [[= mrf::hot]] float x = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 10; ++i) {
+        particles.push_back(Particle{ i, float(i) * 0.5f, "p" });
+    }
+
+    const auto collected = particles.collect();
+    MRF_REQUIRE_EQ(collected.size(), 10);
+    for (int i = 0; i < 10; ++i) {
+        MRF_CHECK_EQ(collected[i].id, i);
+        MRF_CHECK_EQ(collected[i].x, float(i) * 0.5f);
+        MRF_CHECK_EQ(collected[i].name, "p");
+    }
+
+    std::vector<Particle> middle(3);
+    particles.copy_into(middle, 5);
+    MRF_CHECK_EQ(middle[0].id, 5);
+    MRF_CHECK_EQ(middle[2].id, 7);
+}
+
+MRF_TEST_CASE_CTRT("member-wise emplace_back writes lanes of aosoa bucket") {
+    struct Particle {
+        [[= mrf::hot, = mrf::aosoa<4>]] float x = 0;
+        [[= mrf::hot]] float y = 0;
+        std::string_view name;
+    };
+
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < 6; ++i) {
+        particles.emplace_back(float(i), float(i) * 2, "p");
+    }
+    particles.push_back(std::tuple{ 6.0f, 12.0f, "q" });
+
+    MRF_REQUIRE_EQ(particles.size(), 7);
+    for (int i = 0; i < 7; ++i) {
+        MRF_CHECK_EQ(particles[i].x, float(i));
+        MRF_CHECK_EQ(particles[i].y, float(i) * 2);
+    }
+    MRF_CHECK_EQ(particles.back().name, "q");
+}
 } // namespace mrf::test::annotations
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include "doctest_comptime.hpp"
+#include <morfo/morfo.hpp>
+#include <atomic>
+#include <stdexcept>
+
+namespace mrf::test::parallel {
+struct Particle {
+    [[= mrf::hot]] float x = 0;
+    [[= mrf::hot]] float vx = 0;
+    int id = 0;
+    std::string name;
+};
+
+static mrf::vector<Particle> make_particles(int count) {
+    mrf::vector<Particle> particles;
+    for (int i = 0; i < count; ++i) {
+        particles.push_back(Particle{ float(i), 1.0f, i, "p" });
+    }
+    return particles;
+}
+
+MRF_TEST_CASE_RT("mrf::thread_pool runs every index once, nested batches and exceptions included") {
+    mrf::thread_pool pool(4);
+    MRF_REQUIRE_EQ(pool.size(), 4);
+
+    std::vector<int> hits(10'000);
+    pool.for_each_index(hits.size(), [&](std::size_t idx) { hits[idx] += 1; });
+    MRF_REQUIRE(std::ranges::all_of(hits, [](int hit) { return hit == 1; }));
+
+    std::atomic<int> nested = 0;
+    pool.for_each_index(8, [&](std::size_t) { pool.for_each_index(8, [&](std::size_t) { ++nested; }); });
+    MRF_REQUIRE_EQ(nested.load(), 64);
+
+    REQUIRE_THROWS_AS(
+        pool.for_each_index(16, [](std::size_t idx) { if (idx == 3) throw std::runtime_error("failed"); }), std::runtime_error);
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_for_each over a bucket view") {
+    mrf::vector<Particle> particles = make_particles(50'000);
+    mrf::thread_pool pool(4);
+
+    mrf::parallel_for_each(particles.view<mrf::hot>(), [](auto particle) { particle.x += particle.vx; }, pool);
+
+    for (int i = 0; i < 50'000; ++i) {
+        MRF_REQUIRE_EQ(particles[i].x, float(i + 1));
+    }
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_for_each_chunk passes disjoint blocks of spans") {
+    mrf::vector<Particle> particles = make_particles(50'000);
+
+    std::atomic<std::size_t> rows = 0;
+    mrf::parallel_for_each_chunk<256, ^^Particle::id>(particles, [&](std::span<mrf::bucket<Particle, ^^Particle::id>> ids) {
+        for (auto& id : ids) {
+            id.id *= 2;
+        }
+        rows += ids.size();
+    });
+
+    MRF_REQUIRE_EQ(rows.load(), 50'000);
+    for (int i = 0; i < 50'000; ++i) {
+        MRF_REQUIRE_EQ(particles[i].id, 2 * i);
+    }
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_transform/mrf::parallel_reduce over member columns") {
+    mrf::vector<Particle> particles = make_particles(50'000);
+    mrf::thread_pool pool(3);
+
+    mrf::parallel_transform(
+        particles, mrf::proj::member<^^Particle::vx>, [](int id) { return float(id % 4); }, mrf::proj::member<^^Particle::id>, pool);
+
+    const double vx_sum = mrf::parallel_reduce(particles, 0.0, std::plus{}, mrf::proj::member<^^Particle::vx>, pool);
+    MRF_REQUIRE_EQ(vx_sum, 75'000.0);
+
+    const std::int64_t id_sum = mrf::parallel_reduce(particles, std::int64_t{ 0 }, std::plus{}, mrf::proj::member<^^Particle::id>);
+    MRF_REQUIRE_EQ(id_sum, mrf::sum<std::int64_t>(particles, mrf::proj::member<^^Particle::id>));
+
+    mrf::vector<Particle> empty;
+    MRF_REQUIRE_EQ(mrf::parallel_reduce(empty, 7, std::plus{}, mrf::proj::member<^^Particle::id>, pool), 7);
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_collect matches the sequential collect") {
+    const mrf::vector<Particle> particles = make_particles(50'000);
+    mrf::thread_pool pool(4);
+
+    const std::vector<Particle> collected = mrf::parallel_collect(particles, pool);
+    const std::vector<Particle> expected = particles.collect();
+    MRF_REQUIRE_EQ(collected.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        MRF_REQUIRE_EQ(collected[i].id, expected[i].id);
+        MRF_REQUIRE_EQ(collected[i].x, expected[i].x);
+        MRF_REQUIRE_EQ(collected[i].name, expected[i].name);
+    }
+
+    std::vector<Particle> head(10'000);
+    mrf::parallel_copy_into(particles, std::span(head));
+    MRF_REQUIRE_EQ(head.back().id, 9'999);
+}
+} // namespace mrf::test::parallel
\ No newline at end of file
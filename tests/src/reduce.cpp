@@ -0,0 +1,79 @@
+#include "doctest_comptime.hpp"
+#include <morfo/morfo.hpp>
+#include <cstdint>
+#include <type_traits>
+
+namespace mrf::test::reduce {
+struct Reading {
+    [[= mrf::hot]] int sensor = 0;
+    [[= mrf::hot]] double value = 0;
+    std::int64_t ts = 0;
+    [[= mrf::cold, = mrf::aosoa<4>]] float weight = 0;
+    [[= mrf::cold]] float bias = 0;
+};
+
+constexpr mrf::vector<Reading> make_readings(int count) {
+    mrf::vector<Reading> readings;
+    for (int i = 0; i < count; ++i) {
+        const int j = (i * 7) % count;
+        readings.push_back(Reading{ j % 3, j * 0.5, std::int64_t(j) * 1000, float(j), float(-j) });
+    }
+    return readings;
+}
+
+MRF_TEST_CASE_CTRT("mrf::sum/mrf::mean over a dedicated, a shared (strided) and an AoSoA column") {
+    for (const int count : { 1, 5, 8, 1003 }) {
+        const mrf::vector<Reading> readings = make_readings(count);
+        const std::int64_t expected = std::int64_t(count) * (count - 1) / 2;
+
+        MRF_REQUIRE_EQ(mrf::sum(readings, mrf::proj::member<^^Reading::ts>), expected * 1000);
+        MRF_REQUIRE_EQ(mrf::sum(readings, mrf::proj::member<^^Reading::value>), double(expected) * 0.5);
+        MRF_REQUIRE_EQ(mrf::sum<double>(readings, mrf::proj::member<^^Reading::weight>), double(expected));
+        MRF_REQUIRE_EQ(mrf::mean(readings, mrf::proj::member<^^Reading::ts>), double(expected) * 1000 / count);
+    }
+
+    const mrf::vector<Reading> empty;
+    MRF_REQUIRE_EQ(mrf::sum(empty, mrf::proj::member<^^Reading::ts>), 0);
+}
+
+struct Sample {
+    [[= mrf::hot]] std::uint8_t level = 0;
+    [[= mrf::hot]] std::int16_t delta = 0;
+    float gain = 0;
+};
+
+MRF_TEST_CASE_CTRT("mrf::sum accumulates narrow members in 64 bits and float members in double") {
+    mrf::vector<Sample> samples;
+    for (int i = 0; i < 1000; ++i) {
+        samples.push_back(Sample{ 200, -30'000, 0.1f });
+    }
+
+    static_assert(std::is_same_v<decltype(mrf::sum(samples, mrf::proj::member<^^Sample::level>)), std::uint64_t>);
+    static_assert(std::is_same_v<decltype(mrf::sum(samples, mrf::proj::member<^^Sample::delta>)), std::int64_t>);
+    static_assert(std::is_same_v<decltype(mrf::sum(samples, mrf::proj::member<^^Sample::gain>)), double>);
+    static_assert(std::is_same_v<decltype(mrf::sum<float>(samples, mrf::proj::member<^^Sample::gain>)), float>);
+
+    MRF_REQUIRE_EQ(mrf::sum(samples, mrf::proj::member<^^Sample::level>), 200'000u);
+    MRF_REQUIRE_EQ(mrf::sum(samples, mrf::proj::member<^^Sample::delta>), -30'000'000);
+    MRF_REQUIRE_EQ(mrf::sum<std::uint8_t>(samples, mrf::proj::member<^^Sample::level>), std::uint8_t(200'000 % 256));
+}
+
+MRF_TEST_CASE_CTRT("mrf::minmax/mrf::count_if/mrf::reduce over member columns") {
+    const mrf::vector<Reading> readings = make_readings(1003);
+
+    const auto [lowest, highest] = mrf::minmax(readings, mrf::proj::member<^^Reading::bias>);
+    MRF_REQUIRE_EQ(lowest, -1002.0f);
+    MRF_REQUIRE_EQ(highest, 0.0f);
+
+    const auto [first, last] = mrf::minmax(readings, mrf::proj::member<^^Reading::ts>);
+    MRF_REQUIRE_EQ(first, 0);
+    MRF_REQUIRE_EQ(last, 1002000);
+
+    MRF_REQUIRE_EQ(mrf::count_if(readings, [](int sensor) { return sensor == 0; }, mrf::proj::member<^^Reading::sensor>), 335);
+    MRF_REQUIRE_EQ(mrf::count_if(readings, [](float weight) { return weight >= 1000; }, mrf::proj::member<^^Reading::weight>), 3);
+
+    const auto max_of = [](int lhs, int rhs) { return lhs < rhs ? rhs : lhs; };
+    MRF_REQUIRE_EQ(mrf::reduce(readings, -1, max_of, mrf::proj::member<^^Reading::sensor>), 2);
+    MRF_REQUIRE_EQ(mrf::reduce(readings, std::int64_t{ 7 }, std::plus{}, mrf::proj::member<^^Reading::sensor>), 7 + 334 + 2 * 334);
+}
+} // namespace mrf::test::reduce
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "doctest_comptime.hpp"
+#include <morfo/morfo.hpp>
+
+namespace mrf::test::select {
+struct Person {
+    [[= mrf::hot]] int id = 0;
+    [[= mrf::hot]] int age = 0;
+    std::string name;
+};
+
+constexpr mrf::vector<Person> make_persons(int count) {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < count; ++i) {
+        persons.push_back(Person{ i, i % 50, "p" });
+    }
+    return persons;
+}
+
+MRF_TEST_CASE_CTRT("mrf::select: selection vector of the matching rows") {
+    const mrf::vector<Person> persons = make_persons(1000);
+
+    const std::vector<std::size_t> selection =
+        mrf::select(persons, [](int age) { return age >= 45; }, mrf::proj::member<^^Person::age>);
+
+    MRF_REQUIRE_EQ(selection.size(), 100);
+    for (std::size_t k = 0; k < selection.size(); ++k) {
+        MRF_REQUIRE_EQ(selection[k], (k / 5) * 50 + 45 + k % 5);
+    }
+
+    MRF_REQUIRE(mrf::select(persons, [](int age) { return age > 100; }, mrf::proj::member<^^Person::age>).empty());
+}
+
+MRF_TEST_CASE_CTRT("mrf::select_bitmap: bitmap converts into the same selection vector") {
+    const mrf::vector<Person> persons = make_persons(1000);
+    const auto pred = [](int id) { return id % 3 == 0 || id == 999; };
+
+    const std::vector<std::uint64_t> bitmap = mrf::select_bitmap(persons, pred, mrf::proj::member<^^Person::id>);
+
+    MRF_REQUIRE_EQ(bitmap.size(), 16);
+    MRF_REQUIRE(mrf::selection_of(bitmap) == mrf::select(persons, pred, mrf::proj::member<^^Person::id>));
+}
+
+MRF_TEST_CASE_CTRT("mrf::vector::gather/mrf::vector::erase_rows consume a selection vector") {
+    mrf::vector<Person> persons = make_persons(1000);
+
+    const std::vector<std::size_t> selection =
+        mrf::select(persons, [](int age) { return age == 7; }, mrf::proj::member<^^Person::age>);
+
+    const mrf::vector<Person> gathered = persons.gather(selection);
+    MRF_REQUIRE_EQ(gathered.size(), 20);
+    MRF_REQUIRE_EQ(mrf::sum(gathered, mrf::proj::member<^^Person::age>), 140);
+    for (std::size_t k = 0; k < gathered.size(); ++k) {
+        MRF_REQUIRE_EQ(gathered[k].id, int(k * 50 + 7));
+        MRF_REQUIRE_EQ(gathered[k].name, "p");
+    }
+
+    MRF_REQUIRE_EQ(persons.erase_rows(selection), 20);
+    MRF_REQUIRE_EQ(persons.size(), 980);
+    MRF_REQUIRE_EQ(mrf::count_if(persons, [](int age) { return age == 7; }, mrf::proj::member<^^Person::age>), 0);
+    MRF_REQUIRE_EQ(persons[7].id, 8);
+}
+} // namespace mrf::test::select
\ No newline at end of file
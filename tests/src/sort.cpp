@@ -2,6 +2,9 @@
 #include "doctest_fuzzing.hpp"
 #include "morfo/morfo.hpp"
 #include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
 
 namespace mrf::test::sort {
 
@@ -89,4 +92,382 @@ MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
 
     MRF_REQUIRE(std::ranges::equal(actual_sorted, expected_sorted, std::equal_to{}, &Person::age, &Person::age));
 }
+
+MRF_FUZZ_TEST_DOMAIN("mrf::introsort: medium size vector in random order using `proj::bucket<tag>` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    const auto hot_proj = [](const Person& p) { return std::tie(p.id, p.name); };
+
+    mrf::introsort(mrf_persons, std::less{}, mrf::proj::bucket<mrf::hot>);
+    std::ranges::sort(persons, std::less{}, hot_proj);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons, std::equal_to{}, hot_proj, hot_proj));
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::introsort: `mrf::cache_keys` using `proj::bucket<tag>` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    const auto hot_proj = [](const Person& p) { return std::tie(p.id, p.name); };
+
+    mrf::introsort(mrf_persons, std::less{}, mrf::proj::bucket<mrf::hot>, mrf::cache_keys);
+    std::ranges::sort(persons, std::less{}, hot_proj);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons, std::equal_to{}, hot_proj, hot_proj));
+}
+
+/* Projection on `Person::id` counting its evaluations */
+struct counting_id_proj {
+    int* calls;
+
+    template <typename Rng>
+    constexpr int& operator()(Rng& rng, std::size_t idx) const {
+        ++*calls;
+        return mrf::proj::member_t<^^Person::id>{}(rng, idx);
+    }
+};
+
+MRF_TEST_CASE_CTRT("mrf::introsort/mrf::insertsort: `mrf::cache_keys` evaluates the projection once per row") {
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < 100; ++i) {
+        mrf_persons.push_back(Person{ (i * 37) % 100, "p", -((i * 37) % 100) });
+    }
+
+    int calls = 0;
+    mrf::introsort(mrf_persons, std::greater{}, counting_id_proj{ &calls }, mrf::cache_keys);
+    MRF_REQUIRE_EQ(calls, 100);
+
+    for (int i = 0; i < 100; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, 99 - i);
+        MRF_REQUIRE_EQ(mrf_persons[i].age, i - 99);
+    }
+
+    calls = 0;
+    mrf::insertsort(mrf_persons, std::less{}, counting_id_proj{ &calls }, mrf::cache_keys);
+    MRF_REQUIRE_EQ(calls, 100);
+
+    for (int i = 0; i < 100; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, i);
+        MRF_REQUIRE_EQ(mrf_persons[i].age, -i);
+    }
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::impl::heapsort: medium size vector in random order using `proj::member` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    mrf::impl::heapsort(mrf_persons, 0, mrf_persons.size(), std::less{}, mrf::proj::member<^^Person::id>);
+    std::ranges::sort(persons, std::less{}, &Person::id);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons, std::equal_to{}, &Person::id, &Person::id));
+}
+
+MRF_TEST_CASE_RT("mrf::introsort: adversarial inputs (sorted, reversed, equal, organ pipe, median-of-3 killer)") {
+    constexpr int size = 5000;
+
+    const auto check = [](std::vector<int> ids) {
+        mrf::vector<Person> mrf_persons;
+        for (int id : ids) {
+            mrf_persons.push_back(Person{ id, "p", -id });
+        }
+
+        mrf::introsort(mrf_persons, std::less{}, mrf::proj::member<^^Person::id>);
+        std::ranges::sort(ids);
+
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            MRF_REQUIRE_EQ(mrf_persons[i].id, ids[i]);
+            MRF_REQUIRE_EQ(mrf_persons[i].age, -ids[i]);
+        }
+    };
+
+    std::vector<int> sorted(size);
+    std::ranges::iota(sorted, 0);
+    check(sorted);
+
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+    check(reversed);
+
+    check(std::vector<int>(size, 42));
+
+    std::vector<int> organ_pipe(size);
+    for (int i = 0; i < size; ++i) {
+        organ_pipe[i] = std::min(i, size - i);
+    }
+    check(organ_pipe);
+
+    /* Musser's median-of-3 killer */
+    std::vector<int> killer(size);
+    for (int i = 1, k = size / 2; i <= k; ++i) {
+        if (i % 2 == 1) {
+            killer[i - 1] = i;
+            killer[i] = k + i;
+        }
+        killer[k + i - 1] = 2 * i;
+    }
+    check(killer);
+
+    /* Nearly sorted */
+    std::vector<int> nearly_sorted = sorted;
+    std::ranges::swap(nearly_sorted[10], nearly_sorted[size - 10]);
+    check(nearly_sorted);
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::permutation_sort: medium size vector in random order using `proj::member` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    mrf::permutation_sort(mrf_persons, std::less{}, mrf::proj::member<^^Person::age>);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::is_sorted(actual_sorted, std::less{}, &Person::age));
+
+    /* Rows should be moved as a whole */
+    std::ranges::sort(actual_sorted);
+    std::ranges::sort(persons);
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons));
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::stable_sort: medium size vector in random order using `proj::member` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    mrf::stable_sort(mrf_persons, std::greater{}, mrf::proj::member<^^Person::age>);
+    std::ranges::stable_sort(persons, std::greater{}, &Person::age);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons));
+}
+
+MRF_TEST_CASE_CTRT("mrf::stable_sort: sort by secondary, then by primary key") {
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < 100; ++i) {
+        mrf_persons.push_back(Person{ 99 - i, "p", i % 5 });
+    }
+
+    mrf::stable_sort(mrf_persons, std::less{}, mrf::proj::member<^^Person::id>);
+    mrf::stable_sort(mrf_persons, std::less{}, mrf::proj::member<^^Person::age>);
+
+    for (int i = 1; i < 100; ++i) {
+        const bool ordered = mrf_persons[i - 1].age < mrf_persons[i].age ||
+                             (mrf_persons[i - 1].age == mrf_persons[i].age && mrf_persons[i - 1].id < mrf_persons[i].id);
+        MRF_REQUIRE(ordered);
+    }
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::nth_element: medium size vector in random order using `proj::member` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    const std::size_t nth = persons.size() / 3;
+    mrf::nth_element(mrf_persons, nth, std::less{}, mrf::proj::member<^^Person::id>);
+    std::ranges::nth_element(persons, persons.begin() + nth, std::less{}, &Person::id);
+
+    MRF_REQUIRE_EQ(mrf_persons[nth].id, persons[nth].id);
+    for (std::size_t i = 0; i < nth; ++i) {
+        MRF_REQUIRE_LE(mrf_persons[i].id, mrf_persons[nth].id);
+    }
+    for (std::size_t i = nth + 1; i < mrf_persons.size(); ++i) {
+        MRF_REQUIRE_GE(mrf_persons[i].id, mrf_persons[nth].id);
+    }
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::partial_sort: medium size vector in random order using `proj::bucket<tag>` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    const auto hot_proj = [](const Person& p) { return std::tie(p.id, p.name); };
+
+    constexpr std::size_t middle = 100;
+    mrf::partial_sort(mrf_persons, middle, std::less{}, mrf::proj::bucket<mrf::hot>);
+    std::ranges::partial_sort(persons, persons.begin() + middle, std::less{}, hot_proj);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    MRF_REQUIRE(std::ranges::equal(
+        actual_sorted | std::views::take(middle), persons | std::views::take(middle), std::equal_to{}, hot_proj, hot_proj));
+}
+
+MRF_TEST_CASE_CTRT("mrf::top_k: row indices of the best rows without moving them") {
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < 200; ++i) {
+        mrf_persons.push_back(Person{ i, "p", (i * 37) % 200 });
+    }
+
+    const std::vector<std::size_t> best = mrf::top_k(mrf_persons, 10, std::greater{}, mrf::proj::member<^^Person::age>);
+
+    MRF_REQUIRE_EQ(best.size(), 10);
+    for (std::size_t i = 0; i < best.size(); ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[best[i]].age, 199 - int(i));
+    }
+
+    /* Rows stay in place */
+    for (int i = 0; i < 200; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, i);
+    }
+
+    MRF_REQUIRE(mrf::top_k(mrf_persons, 0, std::less{}, mrf::proj::member<^^Person::age>).empty());
+    MRF_REQUIRE_EQ(mrf::top_k(mrf_persons, 500, std::less{}, mrf::proj::member<^^Person::age>).size(), 200);
+}
+
+MRF_FUZZ_TEST_DOMAIN("mrf::radix_sort: medium size vector in random order using `proj::member` projection",
+    fuzz::loop(50),
+    fuzz::vector_of<Person>().size(500, 1000))
+MRF_FUZZ_TEST_CASE(std::vector<Person> persons) {
+    mrf::vector<Person> mrf_persons;
+    std::ranges::transform(persons, std::back_inserter(mrf_persons), mrf::from);
+
+    mrf::radix_sort(mrf_persons, mrf::proj::member<^^Person::age>);
+    std::ranges::stable_sort(persons, std::less{}, &Person::age);
+
+    std::vector<Person> actual_sorted;
+    std::ranges::transform(mrf_persons, std::back_inserter(actual_sorted), mrf::into);
+
+    /* Radix sort is stable */
+    MRF_REQUIRE(std::ranges::equal(actual_sorted, persons));
+}
+
+struct Reading {
+    std::int64_t ts{};
+    double value{};
+    float weight{};
+    std::uint16_t sensor{};
+};
+
+MRF_TEST_CASE_CTRT("mrf::radix_sort: signed, unsigned and floating point keys") {
+    mrf::vector<Reading> readings;
+    for (int i = 0; i < 300; ++i) {
+        const int j = (i * 37) % 300;
+        readings.push_back(Reading{ std::int64_t(j - 150) * 1'000'000'007, (j - 150) / 4.0, float(150 - j), std::uint16_t(j * 200) });
+    }
+
+    mrf::radix_sort(readings, mrf::proj::member<^^Reading::ts>);
+    for (int i = 0; i < 300; ++i) {
+        MRF_REQUIRE_EQ(readings[i].ts, std::int64_t(i - 150) * 1'000'000'007);
+        MRF_REQUIRE_EQ(readings[i].sensor, std::uint16_t(i * 200));
+    }
+
+    mrf::radix_sort(readings, mrf::proj::member<^^Reading::weight>);
+    for (int i = 0; i < 300; ++i) {
+        MRF_REQUIRE_EQ(readings[i].weight, float(i - 149));
+        MRF_REQUIRE_EQ(readings[i].value, (149 - i) / 4.0);
+    }
+
+    mrf::radix_sort(readings, mrf::proj::member<^^Reading::value>);
+    for (int i = 0; i < 300; ++i) {
+        MRF_REQUIRE_EQ(readings[i].value, (i - 150) / 4.0);
+    }
+
+    mrf::radix_sort(readings, mrf::proj::member<^^Reading::sensor>);
+    for (int i = 0; i < 300; ++i) {
+        MRF_REQUIRE_EQ(readings[i].sensor, std::uint16_t(i * 200));
+    }
+}
+
+MRF_TEST_CASE_CTRT("mrf::permutation_sort: sort a view by its bucket keeps the rows intact") {
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < 50; ++i) {
+        mrf_persons.push_back(Person{ 50 - i, "p", i });
+    }
+
+    auto hot = mrf_persons.view<mrf::hot>();
+    mrf::permutation_sort(hot, std::less{}, mrf::proj::bucket<mrf::hot>);
+
+    for (int i = 0; i < 50; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, i + 1);
+        MRF_REQUIRE_EQ(mrf_persons[i].age, 49 - i);
+    }
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_sort: large vector sorted by several threads keeps the rows intact") {
+    constexpr int size = 50'000;
+
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < size; ++i) {
+        const int id = int((i * 7919LL) % size);
+        mrf_persons.push_back(Person{ id, "p", -id });
+    }
+
+    mrf::thread_pool pool(8);
+    mrf::parallel_sort(mrf_persons, std::less{}, mrf::proj::member<^^Person::id>, pool);
+
+    for (int i = 0; i < size; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, i);
+        MRF_REQUIRE_EQ(mrf_persons[i].age, -i);
+    }
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_sort: equal keys keep their order and exceptions reach the caller") {
+    constexpr int size = 50'000;
+
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < size; ++i) {
+        mrf_persons.push_back(Person{ (size - i) % 7, "p", i });
+    }
+
+    mrf::thread_pool pool(4);
+    mrf::parallel_sort(mrf_persons, std::less{}, mrf::proj::member<^^Person::id>, pool);
+
+    for (int i = 1; i < size; ++i) {
+        const bool is_ordered = mrf_persons[i - 1].id < mrf_persons[i].id
+                             || (mrf_persons[i - 1].id == mrf_persons[i].id && mrf_persons[i - 1].age < mrf_persons[i].age);
+        MRF_REQUIRE(is_ordered);
+    }
+
+    const auto throwing_less = [](int lhs, int rhs) {
+        if (lhs == 3 && rhs == 3) throw std::runtime_error("failed");
+        return lhs < rhs;
+    };
+    REQUIRE_THROWS_AS(mrf::parallel_sort(mrf_persons, throwing_less, mrf::proj::member<^^Person::id>, pool), std::runtime_error);
+}
+
+MRF_TEST_CASE_RT("mrf::parallel_sort: small vector is sorted on the calling thread") {
+    mrf::vector<Person> mrf_persons;
+    for (int i = 0; i < 50; ++i) {
+        mrf_persons.push_back(Person{ 50 - i, "p", i });
+    }
+
+    mrf::thread_pool pool(4);
+    mrf::parallel_sort(mrf_persons, std::less{}, mrf::proj::bucket<mrf::hot>, pool);
+
+    for (int i = 0; i < 50; ++i) {
+        MRF_REQUIRE_EQ(mrf_persons[i].id, i + 1);
+        MRF_REQUIRE_EQ(mrf_persons[i].age, 49 - i);
+    }
+}
 } // namespace mrf::test::sort
\ No newline at end of file
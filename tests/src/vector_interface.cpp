@@ -51,6 +51,30 @@ MRF_TEST_CASE_CTRT("resize with default value should override default-initialilz
     MRF_REQUIRE_EQ(persons.back().surname, "Block");
 }
 
+MRF_TEST_CASE_CTRT("resize_for_overwrite should grow every bucket to be overwritten afterwards") {
+    mrf::vector<Person, mrf::default_init_allocator<std::allocator<Person>>> persons;
+    persons.push_back(Person{ 1, 19, "Ken", "Block" });
+
+    persons.resize_for_overwrite(4);
+    MRF_REQUIRE_EQ(persons.size(), 4);
+    MRF_REQUIRE_EQ(persons.front().name, "Ken");
+
+    for (int i = 1; i < 4; ++i) {
+        persons[i].from(Person{ i + 1, 20 + i, "Bob", "Guy" });
+    }
+
+    MRF_REQUIRE_EQ(persons[3].id, 4);
+    MRF_REQUIRE_EQ(persons[3].age, 23);
+    MRF_REQUIRE_EQ(persons[3].surname, "Guy");
+
+    persons.resize_for_overwrite(2);
+    MRF_REQUIRE_EQ(persons.size(), 2);
+    MRF_REQUIRE_EQ(persons.back().id, 2);
+
+    /* Without `mrf::default_init_allocator` it would be a plain `resize` */
+    static_assert(!requires(mrf::vector<Person>& value_initialized) { value_initialized.resize_for_overwrite(1); });
+}
+
 MRF_TEST_CASE_CTRT("reserve should increase the capacity but not the size") {
     mrf::vector<Person> persons;
     MRF_CHECK_EQ(persons.capacity(), 0);
@@ -60,6 +84,88 @@ MRF_TEST_CASE_CTRT("reserve should increase the capacity but not the size") {
     MRF_REQUIRE_EQ(persons.size(), 0);
 }
 
+MRF_TEST_CASE_CTRT("all buckets grow in lockstep and share the same capacity") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 5; ++i) {
+        persons.push_back(Person{ i, 19, "Bob", "Guy" });
+    }
+
+    MRF_REQUIRE_EQ(persons.capacity(), 8);
+    MRF_REQUIRE_EQ(persons.bucket<^^Person::id>().capacity(), persons.capacity());
+    MRF_REQUIRE_EQ(persons.bucket<^^Person::age>().capacity(), persons.capacity());
+    MRF_REQUIRE_EQ(persons.bucket<^^Person::name>().capacity(), persons.capacity());
+    MRF_REQUIRE_EQ(persons.bucket<^^Person::surname>().capacity(), persons.capacity());
+}
+
+MRF_TEST_CASE_CTRT("push_back a reference into the same vector while it regrows") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Bob", "Guy" });
+    persons.push_back(Person{ 2, 25, "Alice", "Guy" });
+
+    MRF_REQUIRE_EQ(persons.size(), persons.capacity());
+    persons.push_back(persons.front());
+
+    MRF_REQUIRE_EQ(persons.size(), 3);
+    MRF_REQUIRE_EQ(persons.back().id, 1);
+    MRF_REQUIRE_EQ(persons.back().name, "Bob");
+}
+
+MRF_TEST_CASE_RT("mrf::pmr::vector allocates every bucket from the given memory resource") {
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    mrf::pmr::vector<Person> persons(&arena);
+    persons.push_back(Person{ 1, 19, "Bob", "Guy" });
+    persons.push_back(Person{ 2, 25, "Alice", "Guy" });
+    persons.push_back(Person{ 3, 33, "Jesus", "Christs" });
+
+    REQUIRE_EQ(persons.size(), 3);
+    REQUIRE_EQ(persons.back().name, "Jesus");
+    REQUIRE_EQ(persons.get_allocator().resource(), &arena);
+    REQUIRE_EQ(persons.bucket<^^Person::id>().get_allocator().resource(), &arena);
+    REQUIRE_EQ(persons.bucket<^^Person::surname>().get_allocator().resource(), &arena);
+}
+
+MRF_TEST_CASE_RT("mrf::pmr::vector bucket could use its own memory resource") {
+    std::pmr::unsynchronized_pool_resource hot_pool;
+
+    mrf::pmr::vector<Person> persons(std::pmr::new_delete_resource(), mrf::bucket_resource<^^Person::name>(&hot_pool));
+    persons.push_back(Person{ 1, 19, "Bob", "Guy" });
+    persons.push_back(Person{ 2, 25, "Alice", "Guy" });
+
+    REQUIRE_EQ(persons.front().name, "Bob");
+    REQUIRE_EQ(persons.bucket<^^Person::name>().get_allocator().resource(), &hot_pool);
+    REQUIRE_EQ(persons.bucket<^^Person::age>().get_allocator().resource(), std::pmr::new_delete_resource());
+}
+
+MRF_TEST_CASE_RT("mrf::pmr::vector get_allocator ignores the bucket overrides") {
+    std::pmr::unsynchronized_pool_resource id_pool;
+
+    mrf::pmr::vector<Person> persons(std::pmr::new_delete_resource(), mrf::bucket_resource<^^Person::id>(&id_pool));
+    persons.push_back(Person{ 1, 19, "Bob", "Guy" });
+    REQUIRE_EQ(persons.get_allocator().resource(), std::pmr::new_delete_resource());
+
+    const std::array<std::size_t, 1> rows{ 0 };
+    const auto gathered = persons.gather(rows);
+    REQUIRE_EQ(gathered.bucket<^^Person::id>().get_allocator().resource(), std::pmr::new_delete_resource());
+    REQUIRE_EQ(gathered.front().name, "Bob");
+}
+
+MRF_TEST_CASE_RT("mrf::pmr::vector accepts references produced by `mrf::from`") {
+    std::vector<Person> original = {
+        Person{ 1, 19, "Bob", "Guy" },
+        Person{ 2, 25, "Alice", "Guy" },
+    };
+
+    mrf::pmr::vector<Person> persons;
+    for (const Person& person : original) {
+        persons.push_back(mrf::from(person));
+    }
+
+    REQUIRE_EQ(persons.size(), 2);
+    REQUIRE_EQ(persons.back().into(), original.back());
+}
+
 MRF_TEST_CASE_CTRT("clear should remove all items but keep the capacity unchanged") {
     mrf::vector<Person> persons;
     persons.push_back(Person{ 1, 19, "Bob", "Guy" });
@@ -139,6 +245,210 @@ MRF_TEST_CASE_CTRT("emplace_back should emplace non-default constructible item")
     MRF_REQUIRE_EQ(persons.back().name, "Alice");
 }
 
+MRF_TEST_CASE_CTRT("member-wise emplace_back and push_back of a tuple construct members in their buckets") {
+    struct Payload {
+        constexpr Payload(int value)
+            : value(value) {}
+        constexpr Payload(const Payload& that)
+            : value(that.value)
+            , copies(that.copies + 1) {}
+        constexpr Payload& operator=(const Payload&) = default;
+
+        int value = 0;
+        int copies = 0;
+    };
+
+    struct [[= mrf::cold]] Row {
+        [[= mrf::hot]] int id = 0;
+        std::string name;
+        Payload payload = 0;
+    };
+
+    mrf::vector<Row> rows;
+    rows.reserve(2);
+    rows.emplace_back(1, "one", 10);
+    rows.push_back(std::tuple{ 2, "two", 20 });
+    MRF_REQUIRE_EQ(rows[0].name, "one");
+    MRF_REQUIRE_EQ(rows[0].payload.copies, 0);
+    MRF_REQUIRE_EQ(rows[1].id, 2);
+    MRF_REQUIRE_EQ(rows[1].payload.value, 20);
+
+    /* Arguments referring into the vector itself while it regrows */
+    rows.emplace_back(rows[0].id, rows[1].name, rows[0].payload);
+    rows.push_back(rows[1].into_tuple());
+    MRF_REQUIRE_EQ(rows.size(), 4);
+    MRF_REQUIRE_EQ(rows[2].id, 1);
+    MRF_REQUIRE_EQ(rows[2].name, "two");
+    MRF_REQUIRE_EQ(rows[2].payload.value, 10);
+    MRF_REQUIRE_EQ(rows[3].name, "two");
+
+    /* Not member-wise - goes through `Row{ args... }` */
+    rows.emplace_back(5);
+    MRF_REQUIRE_EQ(rows.back().id, 5);
+    MRF_REQUIRE_EQ(rows.back().payload.value, 0);
+}
+
+MRF_TEST_CASE_CTRT("insert should shift the tail of every bucket") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 3, 33, "Jesus", "Christs" });
+
+    auto it = persons.insert(persons.cbegin() + 1, Person{ 2, 25, "Bob", "Guy" });
+    MRF_REQUIRE_EQ(it->name, "Bob");
+
+    persons.insert(persons.cbegin(), persons.back());
+    persons.insert(persons.cend(), Person{ 4, 42, "Ken", "Block" });
+
+    MRF_REQUIRE_EQ(persons.size(), 5);
+    MRF_REQUIRE_EQ(persons[0].name, "Jesus");
+    MRF_REQUIRE_EQ(persons[1].name, "Alice");
+    MRF_REQUIRE_EQ(persons[2].name, "Bob");
+    MRF_REQUIRE_EQ(persons[3].surname, "Christs");
+    MRF_REQUIRE_EQ(persons[4].age, 42);
+}
+
+MRF_TEST_CASE_CTRT("erase should remove a single row or a range of rows") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 6; ++i) {
+        persons.push_back(Person{ i, 20 + i, "Bob", "Guy" });
+    }
+
+    auto it = persons.erase(persons.cbegin() + 1);
+    MRF_REQUIRE_EQ(it->id, 2);
+
+    it = persons.erase(persons.cbegin() + 2, persons.cbegin() + 4);
+    MRF_REQUIRE_EQ(it->id, 5);
+
+    MRF_REQUIRE_EQ(persons.size(), 3);
+    MRF_REQUIRE_EQ(persons[0].id, 0);
+    MRF_REQUIRE_EQ(persons[1].age, 22);
+    MRF_REQUIRE_EQ(persons[2].id, 5);
+}
+
+MRF_TEST_CASE_CTRT("erase_if should compact every bucket keeping the order of survivors") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 10; ++i) {
+        persons.push_back(Person{ i, 20 + i, "Bob", "Guy" });
+    }
+
+    const auto erased = mrf::erase_if(persons, [](const auto& person) { return person.id % 3 == 0; });
+
+    MRF_REQUIRE_EQ(erased, 4);
+    MRF_REQUIRE_EQ(persons.size(), 6);
+    MRF_REQUIRE_EQ(persons.capacity(), 16);
+
+    const int expected_ids[] = { 1, 2, 4, 5, 7, 8 };
+    for (std::size_t idx = 0; idx < persons.size(); ++idx) {
+        MRF_REQUIRE_EQ(persons[idx].id, expected_ids[idx]);
+        MRF_REQUIRE_EQ(persons[idx].age, 20 + expected_ids[idx]);
+    }
+
+    MRF_REQUIRE_EQ(persons.erase_if([](const auto&) { return false; }), 0);
+    MRF_REQUIRE_EQ(persons.size(), 6);
+}
+
+MRF_TEST_CASE_CTRT("erase_unordered should move the last row into the hole") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 4; ++i) {
+        persons.push_back(Person{ i, 20 + i, "Bob", "Guy" });
+    }
+
+    persons.erase_unordered(1);
+    MRF_REQUIRE_EQ(persons.size(), 3);
+    MRF_REQUIRE_EQ(persons[1].id, 3);
+    MRF_REQUIRE_EQ(persons[1].age, 23);
+
+    persons.erase_unordered(2);
+    MRF_REQUIRE_EQ(persons.size(), 2);
+    MRF_REQUIRE_EQ(persons.back().id, 3);
+}
+
+MRF_TEST_CASE_CTRT("erase_unordered_if should fill the holes with the rows from the tail") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 10; ++i) {
+        persons.push_back(Person{ i, 20 + i, "Bob", "Guy" });
+    }
+
+    const auto erased = persons.erase_unordered_if([](const auto& person) { return person.id % 3 == 0; });
+
+    MRF_REQUIRE_EQ(erased, 4);
+    MRF_REQUIRE_EQ(persons.size(), 6);
+
+    const int expected_ids[] = { 8, 1, 2, 7, 4, 5 };
+    for (std::size_t idx = 0; idx < persons.size(); ++idx) {
+        MRF_REQUIRE_EQ(persons[idx].id, expected_ids[idx]);
+        MRF_REQUIRE_EQ(persons[idx].age, 20 + expected_ids[idx]);
+    }
+}
+
+MRF_TEST_CASE_CTRT("append_range appends a range of original values") {
+    const std::vector<Person> original = {
+        Person{ 1, 19, "Alice", "Bay" },
+        Person{ 2, 25, "Bob", "Guy" },
+        Person{ 3, 33, "Jesus", "Christs" },
+    };
+
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 0, 1, "Ann", "Bay" });
+    persons.append_range(original);
+
+    MRF_REQUIRE_EQ(persons.size(), 4);
+    MRF_REQUIRE_EQ(persons.capacity(), 4);
+    MRF_REQUIRE_EQ(persons.front().name, "Ann");
+    MRF_REQUIRE(std::ranges::equal(persons | std::views::drop(1), original, std::equal_to{}, mrf::into));
+}
+
+MRF_TEST_CASE_CTRT("append_range appends another mrf::vector and its references") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 2, 25, "Bob", "Guy" });
+
+    mrf::vector<Person> other;
+    other.append_range(persons);
+    other.append_range(persons | std::views::reverse);
+    other.append_range(other);
+
+    MRF_REQUIRE_EQ(other.size(), 8);
+    MRF_REQUIRE_EQ(other[1].name, "Bob");
+    MRF_REQUIRE_EQ(other[2].name, "Bob");
+    MRF_REQUIRE_EQ(other[7].name, "Alice");
+}
+
+MRF_TEST_CASE_CTRT("append_range and assign_range of a view over the same vector") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 2, 25, "Bob", "Guy" });
+
+    persons.append_range(std::views::all(persons));
+    persons.append_range(persons | std::views::take(3));
+    persons.append_range(persons | std::views::drop(5) | std::views::reverse);
+
+    MRF_REQUIRE_EQ(persons.size(), 9);
+    MRF_REQUIRE_EQ(persons[3].name, "Bob");
+    MRF_REQUIRE_EQ(persons[6].name, "Alice");
+    MRF_REQUIRE_EQ(persons[7].name, "Alice");
+    MRF_REQUIRE_EQ(persons[8].id, 2);
+
+    persons.assign_range(persons | std::views::drop(7));
+    MRF_REQUIRE_EQ(persons.size(), 2);
+    MRF_REQUIRE_EQ(persons.front().name, "Alice");
+    MRF_REQUIRE_EQ(persons.back().surname, "Guy");
+}
+
+MRF_TEST_CASE_CTRT("range constructor and assign_range") {
+    const std::vector<Person> original = {
+        Person{ 1, 19, "Alice", "Bay" },
+        Person{ 2, 25, "Bob", "Guy" },
+    };
+
+    mrf::vector<Person> persons(std::from_range, original);
+    MRF_REQUIRE(std::ranges::equal(persons, original, std::equal_to{}, mrf::into));
+
+    persons.assign_range(original | std::views::take(1));
+    MRF_REQUIRE_EQ(persons.size(), 1);
+    MRF_REQUIRE_EQ(persons.back().name, "Alice");
+}
+
 MRF_TEST_CASE_CTRT("iterate non-const vector") {
     mrf::vector<Person> persons;
     persons.push_back(Person{ 1, 19, "Alice", "Bay" });
@@ -160,6 +470,149 @@ MRF_TEST_CASE_CTRT("iterate non-const vector") {
     MRF_REQUIRE(std::ranges::equal(actual, expected));
 }
 
+MRF_TEST_CASE_CTRT("fast_view iterates all rows through the cached bucket pointers") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 2, 25, "Bob", "Guy" });
+    persons.push_back(Person{ 3, 33, "Jesus", "Christs" });
+
+    for (mrf::vector<Person>::reference person : persons.fast_view()) {
+        person.age += 1;
+    }
+
+    const auto& const_persons = persons;
+    const auto view = const_persons.fast_view();
+
+    int age_sum = 0;
+    for (const auto& person : view) {
+        age_sum += mrf::proj::member<^^Person::age>(person);
+    }
+
+    MRF_REQUIRE_EQ(age_sum, 80);
+    MRF_REQUIRE_EQ(view.size(), 3);
+    MRF_REQUIRE_EQ(std::ranges::distance(view), 3);
+    MRF_REQUIRE_EQ(view[1].name, "Bob");
+    MRF_REQUIRE_EQ((view.begin() + 2)->surname, "Christs");
+    MRF_REQUIRE(std::ranges::equal(view, persons, std::equal_to{}, mrf::into, mrf::into));
+}
+
+MRF_TEST_CASE_CTRT("lazy reference resolves members on access") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 2, 25, "Bob", "Guy" });
+
+    static_assert(sizeof(mrf::lazy_reference<mrf::vector<Person>>) == sizeof(void*) + sizeof(std::size_t));
+
+    auto alice = persons.lazy(0);
+    alice.get<^^Person::age>() += 1;
+
+    auto [id, age, name, surname] = alice;
+    MRF_REQUIRE_EQ(id, 1);
+    MRF_REQUIRE_EQ(age, 20);
+    MRF_REQUIRE_EQ(name, "Alice");
+    MRF_REQUIRE_EQ(mrf::get<3>(alice), "Bay");
+
+    surname = "Cooper";
+    MRF_REQUIRE_EQ(persons[0].surname, "Cooper");
+    MRF_REQUIRE_EQ(alice.into(), (Person{ 1, 20, "Alice", "Cooper" }));
+
+    alice.from(Person{ 3, 33, "Jesus", "Christs" });
+    MRF_REQUIRE_EQ(persons.front().name, "Jesus");
+
+    const auto& const_persons = persons;
+    mrf::lazy_reference<const mrf::vector<Person>> bob = const_persons.lazy(1);
+    MRF_REQUIRE(bob < const_persons.lazy(0));
+    MRF_REQUIRE(bob == persons.lazy(1));
+
+    persons.lazy(1).steal_from(persons.lazy(0));
+    MRF_REQUIRE_EQ(persons.back().name, "Jesus");
+}
+
+MRF_TEST_CASE_CTRT("lazy_view iterates all rows as lazy references") {
+    mrf::vector<Person> persons;
+    persons.push_back(Person{ 1, 19, "Alice", "Bay" });
+    persons.push_back(Person{ 2, 25, "Bob", "Guy" });
+
+    int age_sum = 0;
+    for (auto person : persons.lazy_view()) {
+        age_sum += person.get<^^Person::age>();
+    }
+    MRF_REQUIRE_EQ(age_sum, 44);
+
+    persons.push_back(persons.lazy(0));
+    MRF_REQUIRE_EQ(persons.size(), 3);
+    MRF_REQUIRE_EQ(persons.back().name, "Alice");
+}
+
+MRF_TEST_CASE_CTRT("for_each_chunk passes blocks of rows as spans into buckets") {
+    mrf::vector<Person> persons;
+    for (int i = 0; i < 10; ++i) {
+        persons.push_back(Person{ i, 20 + i, "name", "surname" });
+    }
+
+    std::vector<std::size_t> chunk_sizes;
+    persons.for_each_chunk<4>([&](auto ids, auto ages, auto names, auto surnames) {
+        MRF_REQUIRE_EQ(ids.size(), ages.size());
+        MRF_REQUIRE_EQ(names.size(), surnames.size());
+        chunk_sizes.push_back(ids.size());
+    });
+    MRF_REQUIRE(chunk_sizes == std::vector<std::size_t>{ 4, 4, 2 });
+
+    persons.for_each_chunk<3, ^^Person::age>([](std::span<mrf::bucket<Person, ^^Person::age>> ages) {
+        for (auto& age : ages) {
+            age.age += 1;
+        }
+    });
+
+    int age_sum = 0;
+    const auto& const_persons = persons;
+    const_persons.for_each_chunk<8, ^^Person::id, ^^Person::age>(
+        [&](std::span<const mrf::bucket<Person, ^^Person::id>> ids, std::span<const mrf::bucket<Person, ^^Person::age>> ages) {
+            for (std::size_t i = 0; i < ids.size(); ++i) {
+                MRF_REQUIRE_EQ(ages[i].age, 21 + ids[i].id);
+                age_sum += ages[i].age;
+            }
+        });
+    MRF_REQUIRE_EQ(age_sum, 255);
+}
+
+MRF_TEST_CASE_CTRT("copy_into and collect transpose the rows into AoS") {
+    mrf::vector<Person> persons;
+    std::vector<Person> expected;
+    for (int i = 0; i < 100; ++i) {
+        persons.push_back(Person{ i, 20 + i, "name", "surname" });
+        expected.push_back(Person{ i, 20 + i, "name", "surname" });
+    }
+
+    MRF_REQUIRE(persons.collect() == expected);
+
+    std::vector<Person> tail(30);
+    persons.copy_into(tail, 70);
+    MRF_REQUIRE(std::ranges::equal(tail, expected | std::views::drop(70)));
+
+    MRF_REQUIRE(std::move(persons).collect() == expected);
+    MRF_REQUIRE(mrf::vector<Person>{}.collect().empty());
+}
+
+MRF_TEST_CASE_CTRT("append_into moves the rows to the end of a std::vector block by block") {
+    mrf::vector<Person> persons;
+    std::vector<Person> expected;
+    for (int i = 0; i < 500; ++i) {
+        persons.push_back(Person{ i, 20 + i, "name", "surname" });
+        expected.push_back(Person{ i, 20 + i, "name", "surname" });
+    }
+
+    std::vector<Person> out = { Person{ -1, 0, "head", "" } };
+    persons.append_into(out, 100, 450);
+    MRF_REQUIRE_EQ(out.size(), 351);
+    MRF_REQUIRE_EQ(out.front().name, "head");
+    MRF_REQUIRE(std::ranges::equal(out | std::views::drop(1), expected | std::views::drop(100) | std::views::take(350)));
+
+    std::vector<Person> all;
+    std::move(persons).append_into(all);
+    MRF_REQUIRE(all == expected);
+}
+
 MRF_TEST_CASE_CTRT("ensure mrf::vector<T>::iterator is indeed random access") {
     mrf::vector<Person> persons;
     persons.push_back(Person{ 1, 19, "Alice", "Bay" });